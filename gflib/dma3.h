@@ -46,10 +46,32 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+// High priority requests are processed before any normal ones. Use it for
+// things that are visible right away, like tiles of on-screen sprites; don't
+// mix priorities for the same destination, since their order isn't kept.
+#define DMA3_PRIORITY_HIGH   0
+#define DMA3_PRIORITY_NORMAL 1
+#define DMA3_PRIORITY_COUNT  2
+
+// Counters for the last frame the DMA3 manager processed.
+struct Dma3Stats
+{
+    u32 bytesMoved;
+    u16 bytesPerLine; // measured throughput used to size the budget
+    u16 flushed;      // times the queue was full and had to be run early
+    u16 coalesced;    // requests merged into an already queued one
+    u8 deferred;      // requests left for a later frame
+    u8 highWaterMark; // most requests pending at once
+};
+
+extern struct Dma3Stats gDma3Stats;
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
+s16 RequestDma3CopyWithPriority(const void *src, void *dest, u16 size, u8 mode, u8 priority);
+s16 RequestDma3FillWithPriority(s32 value, void *dest, u16 size, u8 mode, u8 priority);
 s16 CheckForSpaceForDma3Request(s16 index);
 
 #endif // GUARD_DMA3_H
@@ -8,6 +8,16 @@
 #define DMA_REQUEST_COPY16 3
 #define DMA_REQUEST_FILL16 4
 
+// Requests are only processed during VBlank, stopping before this scanline.
+#define DMA3_LAST_VCOUNT 225
+
+// Starting guess for how many bytes one scanline's worth of time can move,
+// refined every frame from how far VCOUNT actually advanced.
+#define DMA3_INITIAL_BYTES_PER_LINE 600
+#define DMA3_MIN_BYTES_PER_LINE     64
+// Fewer lines than this are too coarse to measure throughput from.
+#define DMA3_MIN_MEASURED_LINES     4
+
 struct Dma3Request
 {
     const u8 *src;
@@ -17,147 +27,300 @@ struct Dma3Request
     u32 value;
 };
 
+// Pending requests are kept in one FIFO per priority, holding indexes into
+// sDma3Requests. A slot is free whenever its size is 0, which is what
+// CheckForSpaceForDma3Request looks at. Free slots are a FIFO as well, so a
+// slot freed in VBlank goes to the back of the line instead of being handed
+// out again right away to a caller still polling the old index.
+struct Dma3Queue
+{
+    u8 slots[MAX_DMA_REQUESTS];
+    u8 head;
+    u8 count;
+};
+
 static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
+static struct Dma3Queue sDma3Queues[DMA3_PRIORITY_COUNT];
+static struct Dma3Queue sDma3FreeSlots;
+static u16 sDma3BytesPerLine;
+static struct Dma3Stats sDma3CurrentStats;
 
 static vbool8 sDma3ManagerLocked;
-static u8 sDma3RequestCursor;
+
+EWRAM_DATA struct Dma3Stats gDma3Stats = {0};
 
 void ClearDma3Requests(void)
 {
     int i;
 
     sDma3ManagerLocked = TRUE;
-    sDma3RequestCursor = 0;
 
     for (i = 0; i < MAX_DMA_REQUESTS; i++)
     {
         sDma3Requests[i].size = 0;
         sDma3Requests[i].src = NULL;
         sDma3Requests[i].dest = NULL;
+        sDma3FreeSlots.slots[i] = i;
     }
+    sDma3FreeSlots.head = 0;
+    sDma3FreeSlots.count = MAX_DMA_REQUESTS;
+
+    for (i = 0; i < DMA3_PRIORITY_COUNT; i++)
+    {
+        sDma3Queues[i].head = 0;
+        sDma3Queues[i].count = 0;
+    }
+
+    sDma3BytesPerLine = DMA3_INITIAL_BYTES_PER_LINE;
+    CpuFill32(0, &sDma3CurrentStats, sizeof(sDma3CurrentStats));
+    CpuFill32(0, &gDma3Stats, sizeof(gDma3Stats));
 
     sDma3ManagerLocked = FALSE;
 }
 
+static void ExecuteDma3Request(struct Dma3Request *request)
+{
+    switch (request->mode)
+    {
+    case DMA_REQUEST_COPY32: // regular 32-bit copy
+        Dma3CopyLarge32_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
+        Dma3FillLarge32_(request->value, request->dest, request->size);
+        break;
+    case DMA_REQUEST_COPY16:    // regular 16-bit copy
+        Dma3CopyLarge16_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
+        Dma3FillLarge16_(request->value, request->dest, request->size);
+        break;
+    }
+}
+
+static void PushDma3Slot(struct Dma3Queue *queue, u8 slot)
+{
+    queue->slots[(queue->head + queue->count) % MAX_DMA_REQUESTS] = slot;
+    queue->count++;
+}
+
+static u8 PopDma3Slot(struct Dma3Queue *queue)
+{
+    u8 slot = queue->slots[queue->head];
+
+    if (++queue->head >= MAX_DMA_REQUESTS)
+        queue->head = 0;
+    queue->count--;
+    return slot;
+}
+
+static void FreeDma3Request(u8 slot)
+{
+    struct Dma3Request *request = &sDma3Requests[slot];
+
+    request->src = NULL;
+    request->dest = NULL;
+    request->size = 0;
+    request->mode = 0;
+    request->value = 0;
+    PushDma3Slot(&sDma3FreeSlots, slot);
+}
+
+// Number of bytes that can still be moved before VBlank ends, based on the
+// throughput measured on previous frames.
+static u32 GetDma3ByteBudget(u8 vcount)
+{
+    if (vcount < DISPLAY_HEIGHT || vcount >= DMA3_LAST_VCOUNT)
+        return 0;
+
+    return (DMA3_LAST_VCOUNT - vcount) * sDma3BytesPerLine;
+}
+
 void ProcessDma3Requests(void)
 {
-    u16 bytesTransferred;
+    u32 bytesTransferred;
+    u8 startVCount, endVCount;
+    int i;
 
     if (sDma3ManagerLocked)
         return;
 
     bytesTransferred = 0;
+    startVCount = *(u8 *)REG_ADDR_VCOUNT;
 
-    // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
-    while (sDma3Requests[sDma3RequestCursor].size != 0)
+    // Drain the queues in priority order for as long as the remaining VBlank
+    // time allows. The first request of a frame always goes through so that a
+    // request larger than the whole budget can't stall the queue forever.
+    for (i = 0; i < DMA3_PRIORITY_COUNT; i++)
     {
-        bytesTransferred += sDma3Requests[sDma3RequestCursor].size;
-
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+        struct Dma3Queue *queue = &sDma3Queues[i];
 
-        switch (sDma3Requests[sDma3RequestCursor].mode)
+        while (queue->count != 0)
         {
-        case DMA_REQUEST_COPY32: // regular 32-bit copy
-            Dma3CopyLarge32_(sDma3Requests[sDma3RequestCursor].src,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
-            Dma3FillLarge32_(sDma3Requests[sDma3RequestCursor].value,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_COPY16:    // regular 16-bit copy
-            Dma3CopyLarge16_(sDma3Requests[sDma3RequestCursor].src,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
-            Dma3FillLarge16_(sDma3Requests[sDma3RequestCursor].value,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
+            u8 slot = queue->slots[queue->head];
+            struct Dma3Request *request = &sDma3Requests[slot];
+            u8 vcount = *(u8 *)REG_ADDR_VCOUNT;
+
+            if (vcount >= DMA3_LAST_VCOUNT)
+                goto done; // we're about to leave vblank, stop
+            if (bytesTransferred != 0 && request->size > GetDma3ByteBudget(vcount))
+                goto done;
+
+            ExecuteDma3Request(request);
+            bytesTransferred += request->size;
+            FreeDma3Request(PopDma3Slot(queue));
         }
+    }
 
-        // Free the request
-        sDma3Requests[sDma3RequestCursor].src = NULL;
-        sDma3Requests[sDma3RequestCursor].dest = NULL;
-        sDma3Requests[sDma3RequestCursor].size = 0;
-        sDma3Requests[sDma3RequestCursor].mode = 0;
-        sDma3Requests[sDma3RequestCursor].value = 0;
-        sDma3RequestCursor++;
+done:
+    endVCount = *(u8 *)REG_ADDR_VCOUNT;
+    if (startVCount >= DISPLAY_HEIGHT && endVCount > startVCount + DMA3_MIN_MEASURED_LINES)
+    {
+        u32 bytesPerLine = bytesTransferred / (endVCount - startVCount);
 
-        if (sDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
-            sDma3RequestCursor = 0;
+        sDma3BytesPerLine = (sDma3BytesPerLine * 3 + bytesPerLine) / 4;
+        if (sDma3BytesPerLine < DMA3_MIN_BYTES_PER_LINE)
+            sDma3BytesPerLine = DMA3_MIN_BYTES_PER_LINE;
     }
+
+    sDma3CurrentStats.bytesMoved = bytesTransferred;
+    sDma3CurrentStats.deferred = MAX_DMA_REQUESTS - sDma3FreeSlots.count;
+    sDma3CurrentStats.bytesPerLine = sDma3BytesPerLine;
+    gDma3Stats = sDma3CurrentStats;
+    CpuFill32(0, &sDma3CurrentStats, sizeof(sDma3CurrentStats));
 }
 
-s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+// Tries to fold the new request into the last one queued at the same
+// priority: either it continues that transfer (adjacent source and
+// destination), or it rewrites the same destination and at least as many
+// bytes, making the earlier one redundant.
+static s16 TryCoalesceDma3Request(struct Dma3Queue *queue, const void *src, void *dest, u16 size, u16 mode, u32 value)
 {
-    int cursor;
-    int i = 0;
+    int tail;
+    struct Dma3Request *request;
+    bool32 isFill;
 
-    sDma3ManagerLocked = TRUE;
-    cursor = sDma3RequestCursor;
+    if (queue->count == 0)
+        return -1;
 
-    while (i < MAX_DMA_REQUESTS)
+    tail = queue->head + queue->count - 1;
+    if (tail >= MAX_DMA_REQUESTS)
+        tail -= MAX_DMA_REQUESTS;
+    tail = queue->slots[tail];
+    request = &sDma3Requests[tail];
+
+    if (request->mode != mode)
+        return -1;
+
+    isFill = (mode == DMA_REQUEST_FILL32 || mode == DMA_REQUEST_FILL16);
+
+    if (request->dest == dest && size >= request->size)
     {
-        if (sDma3Requests[cursor].size == 0) // an empty request was found.
-        {
-            sDma3Requests[cursor].src = src;
-            sDma3Requests[cursor].dest = dest;
-            sDma3Requests[cursor].size = size;
+        request->src = src;
+        request->value = value;
+        request->size = size;
+    }
+    else if (request->dest + request->size == dest
+          && (isFill ? request->value == value : request->src + request->size == src)
+          && request->size + size <= 0xFFFF)
+    {
+        request->size += size;
+    }
+    else
+    {
+        return -1;
+    }
 
-            if (mode == 1)
-                sDma3Requests[cursor].mode = DMA_REQUEST_COPY32;
-            else
-                sDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
+    sDma3CurrentStats.coalesced++;
+    return tail;
+}
 
-            sDma3ManagerLocked = FALSE;
-            return cursor;
+// Runs every queued request immediately.
+static void FlushDma3Requests(void)
+{
+    int i;
+
+    for (i = 0; i < DMA3_PRIORITY_COUNT; i++)
+    {
+        while (sDma3Queues[i].count != 0)
+        {
+            u8 slot = PopDma3Slot(&sDma3Queues[i]);
+
+            ExecuteDma3Request(&sDma3Requests[slot]);
+            FreeDma3Request(slot);
         }
-        if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
-            cursor = 0;
-        i++;
     }
-    sDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+    sDma3CurrentStats.flushed++;
 }
 
-s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+static s16 AddDma3Request(const void *src, void *dest, u16 size, u16 mode, u32 value, u8 priority)
 {
-    int cursor;
-    int i = 0;
+    struct Dma3Queue *queue;
+    s16 slot;
+    u8 pending;
+
+    // Nothing to transfer. Like before, hand back a slot that reads as free.
+    if (size == 0)
+        return sDma3FreeSlots.count != 0 ? sDma3FreeSlots.slots[sDma3FreeSlots.head] : -1;
+
+    if (priority >= DMA3_PRIORITY_COUNT)
+        priority = DMA3_PRIORITY_NORMAL;
+    queue = &sDma3Queues[priority];
 
-    cursor = sDma3RequestCursor;
     sDma3ManagerLocked = TRUE;
 
-    while (i < MAX_DMA_REQUESTS)
+    slot = TryCoalesceDma3Request(queue, src, dest, size, mode, value);
+    if (slot != -1)
     {
-        if (sDma3Requests[cursor].size == 0) // an empty request was found.
-        {
-            sDma3Requests[cursor].dest = dest;
-            sDma3Requests[cursor].size = size;
-            sDma3Requests[cursor].mode = mode;
-            sDma3Requests[cursor].value = value;
-
-            if(mode == 1)
-                sDma3Requests[cursor].mode = DMA_REQUEST_FILL32;
-            else
-                sDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
-
-            sDma3ManagerLocked = FALSE;
-            return cursor;
-        }
-        if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
-            cursor = 0;
-        i++;
+        sDma3ManagerLocked = FALSE;
+        return slot;
     }
+
+    // The queue is full. Rather than dropping the request, make room by running
+    // everything queued so far right away, in the order VBlank would have.
+    // Those transfers happen outside VBlank, but none of them are lost.
+    if (sDma3FreeSlots.count == 0)
+        FlushDma3Requests();
+
+    slot = PopDma3Slot(&sDma3FreeSlots);
+    sDma3Requests[slot].src = src;
+    sDma3Requests[slot].dest = dest;
+    sDma3Requests[slot].size = size;
+    sDma3Requests[slot].mode = mode;
+    sDma3Requests[slot].value = value;
+    PushDma3Slot(queue, slot);
+
+    pending = MAX_DMA_REQUESTS - sDma3FreeSlots.count;
+    if (pending > sDma3CurrentStats.highWaterMark)
+        sDma3CurrentStats.highWaterMark = pending;
+
     sDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+    return slot;
+}
+
+s16 RequestDma3CopyWithPriority(const void *src, void *dest, u16 size, u8 mode, u8 priority)
+{
+    if (mode == 1)
+        return AddDma3Request(src, dest, size, DMA_REQUEST_COPY32, 0, priority);
+    else
+        return AddDma3Request(src, dest, size, DMA_REQUEST_COPY16, 0, priority);
+}
+
+s16 RequestDma3FillWithPriority(s32 value, void *dest, u16 size, u8 mode, u8 priority)
+{
+    if (mode == 1)
+        return AddDma3Request(NULL, dest, size, DMA_REQUEST_FILL32, value, priority);
+    else
+        return AddDma3Request(NULL, dest, size, DMA_REQUEST_FILL16, value, priority);
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    return RequestDma3CopyWithPriority(src, dest, size, mode, DMA3_PRIORITY_NORMAL);
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    return RequestDma3FillWithPriority(value, dest, size, mode, DMA3_PRIORITY_NORMAL);
 }
 
 s16 CheckForSpaceForDma3Request(s16 index)
@@ -57,6 +57,7 @@ static u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x,
 static void ResetOamMatrices(void);
 static void ResetSprite(struct Sprite *sprite);
 static s16 AllocSpriteTiles(u16 tileCount);
+static s16 FindFreeSpriteTiles(u16 tileCount);
 static void RequestSpriteFrameImageCopy(u16 index, u16 tileNum, const struct SpriteFrameImage *images);
 static void ResetAllSprites(void);
 static void BeginAnim(struct Sprite *sprite);
@@ -292,6 +293,7 @@ EWRAM_DATA s16 gSpriteCoordOffsetX = 0;
 EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
 EWRAM_DATA bool8 gAffineAnimsDisabled = FALSE;
+EWRAM_DATA static bool8 (*sSpriteTileReclaimFunc)(void) = NULL;
 
 void ResetSpriteData(void)
 {
@@ -705,7 +707,6 @@ s16 AllocSpriteTiles(u16 tileCount)
 {
     u16 i;
     s16 start;
-    u16 numTilesFound;
 
     if (tileCount == 0)
     {
@@ -716,6 +717,26 @@ s16 AllocSpriteTiles(u16 tileCount)
         return 0;
     }
 
+    // If there's no room, let the owner of any cached tiles give some back and try again.
+    start = FindFreeSpriteTiles(tileCount);
+    while (start < 0 && sSpriteTileReclaimFunc != NULL && sSpriteTileReclaimFunc())
+        start = FindFreeSpriteTiles(tileCount);
+
+    if (start < 0)
+        return -1;
+
+    for (i = start; i < tileCount + start; i++)
+        ALLOC_SPRITE_TILE(i);
+
+    return start;
+}
+
+static s16 FindFreeSpriteTiles(u16 tileCount)
+{
+    u16 i;
+    s16 start;
+    u16 numTilesFound;
+
     i = gReservedSpriteTileCount;
 
     for (;;)
@@ -748,12 +769,16 @@ s16 AllocSpriteTiles(u16 tileCount)
             break;
     }
 
-    for (i = start; i < tileCount + start; i++)
-        ALLOC_SPRITE_TILE(i);
-
     return start;
 }
 
+// Called when sprite tiles can't be allocated. The function should free
+// tiles it no longer needs and return TRUE, or return FALSE if it has none.
+void SetSpriteTileReclaimFunc(bool8 (*func)(void))
+{
+    sSpriteTileReclaimFunc = func;
+}
+
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
 {
     u8 index = bit / 8;
@@ -1497,6 +1522,18 @@ u16 LoadSpriteSheet(const struct SpriteSheet *sheet)
     }
 }
 
+// Like LoadSpriteSheet, but leaves filling the tiles to the caller.
+u16 AllocTilesForSpriteSheet(struct SpriteSheet *sheet)
+{
+    s16 tileStart = AllocSpriteTiles(sheet->size / TILE_SIZE_4BPP);
+
+    if (tileStart < 0)
+        return 0xFFFF;
+
+    AllocSpriteTileRange(sheet->tag, (u16)tileStart, sheet->size / TILE_SIZE_4BPP);
+    return (u16)tileStart;
+}
+
 void LoadSpriteSheets(const struct SpriteSheet *sheets)
 {
     u8 i;
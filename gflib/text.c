@@ -39,6 +39,25 @@ static EWRAM_DATA struct TextPrinter sTempTextPrinter = {0};
 static EWRAM_DATA struct TextPrinter sTextPrinters[NUM_TEXT_PRINTERS] = {0};
 
 static u16 sFontHalfRowLookupTable[0x51];
+
+// Widths of recently measured strings, for menus that re-measure the same
+// labels every time they redraw. Strings that pull in placeholder text aren't
+// cached. Strings outside ROM can be rewritten at any time, so their entries
+// also keep a hash of the contents, which is much cheaper to compute than the
+// width itself.
+#define STRING_WIDTH_CACHE_SIZE 64
+#define IS_ROM_STRING(str) ((u32)(str) >= 0x08000000 && (u32)(str) < 0x0A000000)
+
+struct StringWidthCacheEntry
+{
+    const u8 *str;
+    u32 contentHash;
+    s16 letterSpacing;
+    u8 fontId;
+    u8 width;
+};
+
+static EWRAM_DATA struct StringWidthCacheEntry sStringWidthCache[STRING_WIDTH_CACHE_SIZE] = {0};
 static u16 sLastTextBgColor;
 static u16 sLastTextFgColor;
 static u16 sLastTextShadowColor;
@@ -1327,7 +1346,7 @@ static u32 (*GetFontWidthFunc(u8 fontId))(u16, bool32)
     return NULL;
 }
 
-s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+static s32 MeasureStringWidth(u8 fontId, const u8 *str, s16 letterSpacing, bool32 *usesPlaceholders)
 {
     bool8 isJapanese;
     int minGlyphWidth;
@@ -1379,6 +1398,7 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
                 return 0;
             }
         case CHAR_DYNAMIC:
+            *usesPlaceholders = TRUE;
             if (bufferPointer == NULL)
                 bufferPointer = DynamicPlaceholderTextUtil_GetPlaceholderPtr(*++str);
             while (*bufferPointer != EOS)
@@ -1499,6 +1519,42 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
     return width;
 }
 
+static u32 HashStringContents(const u8 *str)
+{
+    u32 hash = 2166136261;
+
+    while (*str != EOS)
+        hash = (hash ^ *str++) * 16777619;
+    return hash;
+}
+
+s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+{
+    struct StringWidthCacheEntry *entry;
+    bool32 usesPlaceholders = FALSE;
+    u32 contentHash = 0;
+    s32 width;
+
+    if (!IS_ROM_STRING(str))
+        contentHash = HashStringContents(str);
+
+    entry = &sStringWidthCache[(((u32)str >> 1) ^ ((u32)str >> 7) ^ fontId ^ letterSpacing) % STRING_WIDTH_CACHE_SIZE];
+    if (entry->str == str && entry->contentHash == contentHash
+     && entry->fontId == fontId && entry->letterSpacing == letterSpacing)
+        return entry->width;
+
+    width = MeasureStringWidth(fontId, str, letterSpacing, &usesPlaceholders);
+    if (!usesPlaceholders && width <= 0xFF)
+    {
+        entry->str = str;
+        entry->contentHash = contentHash;
+        entry->letterSpacing = letterSpacing;
+        entry->fontId = fontId;
+        entry->width = width;
+    }
+    return width;
+}
+
 u8 RenderTextHandleBold(u8 *pixels, u8 fontId, u8 *str)
 {
     u8 shadowColor;
@@ -34,6 +34,7 @@ enum {
 void GetAIPartyIndexes(u32 battlerId, s32 *firstId, s32 *lastId);
 void AI_TrySwitchOrUseItem(void);
 u8 GetMostSuitableMonToSwitchInto(void);
+void ClearSwitchInCandidates(void);
 bool32 ShouldSwitch(void);
 
 #endif // GUARD_BATTLE_AI_SWITCH_ITEMS_H
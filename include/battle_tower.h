@@ -33,6 +33,8 @@ struct FacilityMon
     u8 nature;
 };
 
+struct FrontierMonPool;
+
 extern const u8 gTowerMaleFacilityClasses[30];
 extern const u8 gTowerMaleTrainerGfxIds[30];
 extern const u8 gTowerFemaleFacilityClasses[20];
@@ -62,6 +64,15 @@ void GetFrontierTrainerName(u8 *dst, u16 trainerId);
 void FillFrontierTrainerParty(u8 monsCount);
 void FillFrontierTrainersParties(u8 monsCount);
 u16 GetRandomFrontierMonFromSet(u16 trainerId);
+u16 GetRandomFrontierMonFromMonSet(const u16 *monSet, bool32 excludeHighTier);
+struct FrontierMonPool *CreateFrontierMonPool(void);
+void DestroyFrontierMonPool(struct FrontierMonPool *pool);
+void AddFrontierMonPoolCandidate(struct FrontierMonPool *pool, u16 monId);
+void AddFrontierMonSetToPool(struct FrontierMonPool *pool, const u16 *monSet, bool32 excludeHighTier);
+void SetFrontierMonPoolItemNoneUnique(struct FrontierMonPool *pool);
+void AddFrontierTrainerMonsToPool(struct FrontierMonPool *pool, u16 trainerId);
+void MarkFrontierMonPoolUsed(struct FrontierMonPool *pool, u16 species, u16 heldItem);
+u16 DrawFrontierMonFromPool(struct FrontierMonPool *pool);
 void FrontierSpeechToString(const u16 *words);
 void DoSpecialTrainerBattle(void);
 void CalcEmeraldBattleTowerChecksum(struct EmeraldBattleTowerRecord *record);
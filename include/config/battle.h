@@ -185,6 +185,7 @@
 #define B_AFFECTION_MECHANICS       FALSE      // In Gen6+, there's a stat called affection that can trigger different effects in battle. From LGPE onwards, those effects use friendship instead.
 #define B_TRAINER_CLASS_POKE_BALLS  GEN_LATEST // In Gen7+, trainers will use certain types of Poké Balls depending on their trainer class.
 #define B_OBEDIENCE_MECHANICS       GEN_LATEST // In PLA+ (here Gen8+), obedience restrictions also apply to non-outsider Pokémon, albeit based on their level met rather than actual level
+#define B_SCRIPT_CMDS_PER_FRAME     32         // Max number of battle script commands run in a single frame while they only do logic (jumps, calcs, flags). This counts commands, not CPU cycles: a damage calc costs far more than a jump, so it isn't a time budget. Set to 1 to run one command per frame.
 
 // Animation Settings
 #define B_NEW_SWORD_PARTICLE            TRUE    // If set to TRUE, it updates Swords Dance's particle.
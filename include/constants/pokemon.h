@@ -128,6 +128,11 @@
 // Shiny odds
 #define SHINY_ODDS 8 // Actual probability is SHINY_ODDS/65536
 
+// Shininess requested from GeneratePersonality
+#define PERSONALITY_SHINY_ANY 0
+#define PERSONALITY_SHINY     1
+#define PERSONALITY_NOT_SHINY 2
+
 // Ribbon IDs used by TV and Pokénav
 #define CHAMPION_RIBBON       0
 #define COOL_RIBBON_NORMAL    1
@@ -3,10 +3,28 @@
 
 #include "sprite.h"
 
+// gbagfx sets these bits of the LZ header for data that LZ77UnCompVram can't
+// decompress straight to its destination (see tools/gbagfx/lz.h).
+#define LZ_HEADER_RESERVED_MASK 0x0F
+
 extern u8 gDecompressionBuffer[0x4000];
 
 void LZDecompressWram(const u32 *src, void *dest);
 void LZDecompressVram(const u32 *src, void *dest);
+bool8 IsLZ77DataVramSafe(const u32 *src);
+
+// Decompression spread over several frames, for data that can be requested
+// ahead of when it's needed. Only map connection tilesets use it. Trainer and
+// mon pics stay synchronous: battle controllers create the sprite in the same
+// command that decompresses the pic and copy its first frame to VRAM right
+// away, so slicing them would mean restructuring every controller's commands.
+#define LZ77_JOB_NONE 0xFF
+
+u8 StartLZ77Decompression(const u32 *src, void *dest);
+void RunLZ77DecompressionQueue(void);
+bool8 IsLZ77DecompressionDone(u8 jobId);
+void FinishLZ77Decompression(u8 jobId);
+void CancelLZ77Decompression(u8 jobId);
 
 u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src);
 void LoadCompressedSpriteSheetOverrideBuffer(const struct CompressedSpriteSheet *src, void *buffer);
@@ -126,6 +126,11 @@ struct MapEvents
     struct WarpEvent *warps;
     struct CoordEvent *coordEvents;
     struct BgEvent *bgEvents;
+    // Indexes into the arrays above sorted by position (y, then x), generated by mapjson.
+    // NULL if the map has none of those events.
+    const u8 *warpsByPosition;
+    const u8 *coordEventsByPosition;
+    const u8 *bgEventsByPosition;
 };
 
 struct MapConnection
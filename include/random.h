@@ -20,4 +20,37 @@ u16 Random2(void);
 void SeedRng(u16 seed);
 void SeedRng2(u16 seed);
 
+// Independent streams for the bounded functions below. The battle stream is
+// the one Random() draws from, which link and recorded battles rely on staying
+// in step; overworld effects use their own so they don't shift it.
+#define RNG_STREAM_BATTLE    0
+#define RNG_STREAM_OVERWORLD 1
+
+extern u32 gRngOverworldValue;
+
+void SeedRngOverworld(u16 seed);
+u16 RandomOverworld(void);
+
+// Returns a number in [0, n) for n up to 0x10000, unbiased and without a
+// division in the common case. Use instead of Random() % n.
+u32 RandomUniformFromStream(u8 stream, u32 n);
+// Returns a number in [lo, hi].
+u32 RandomRangeFromStream(u8 stream, u32 lo, u32 hi);
+// Returns TRUE with a percent% chance.
+bool32 RandomPercentFromStream(u8 stream, u32 percent);
+// Returns an index into cumulativeWeights, each with a chance proportional to
+// its weight. cumulativeWeights holds running totals, so the last entry is
+// the total weight.
+u32 RandomWeightedFromStream(u8 stream, const u16 *cumulativeWeights, u32 count);
+
+#define RandomUniform(n)                        RandomUniformFromStream(RNG_STREAM_BATTLE, n)
+#define RandomRange(lo, hi)                     RandomRangeFromStream(RNG_STREAM_BATTLE, lo, hi)
+#define RandomPercent(percent)                  RandomPercentFromStream(RNG_STREAM_BATTLE, percent)
+#define RandomWeighted(cumulativeWeights)       RandomWeightedFromStream(RNG_STREAM_BATTLE, cumulativeWeights, ARRAY_COUNT(cumulativeWeights))
+
+#define RandomUniformOverworld(n)                  RandomUniformFromStream(RNG_STREAM_OVERWORLD, n)
+#define RandomRangeOverworld(lo, hi)               RandomRangeFromStream(RNG_STREAM_OVERWORLD, lo, hi)
+#define RandomPercentOverworld(percent)            RandomPercentFromStream(RNG_STREAM_OVERWORLD, percent)
+#define RandomWeightedOverworld(cumulativeWeights) RandomWeightedFromStream(RNG_STREAM_OVERWORLD, cumulativeWeights, ARRAY_COUNT(cumulativeWeights))
+
 #endif // GUARD_RANDOM_H
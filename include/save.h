@@ -2,7 +2,8 @@
 #define GUARD_SAVE_H
 
 // Each 4 KiB flash sector contains 3968 bytes of actual data followed by a 128 byte footer.
-// Only 12 bytes of the footer are used.
+// Only 12 bytes of the footer are used, except in the SaveBlock2 sector which also holds the
+// save slot's manifest (see struct SaveSlotManifest).
 #define SECTOR_DATA_SIZE 3968
 #define SECTOR_FOOTER_SIZE 128
 #define SECTOR_SIZE (SECTOR_DATA_SIZE + SECTOR_FOOTER_SIZE)
@@ -12,6 +13,10 @@
 // If the sector's signature field is not this value then the sector is either invalid or empty.
 #define SECTOR_SIGNATURE 0x8012025
 
+// If the manifest's signature field is not this value then the save slot was written
+// without one, and every sector in it must have the same counter.
+#define SAVE_MANIFEST_SIGNATURE 0x4D414E49
+
 #define SPECIAL_SECTOR_SENTINEL 0xB39D
 
 #define SECTOR_ID_SAVEBLOCK2          0
@@ -66,10 +71,21 @@ struct SaveSectorLocation
     u16 size;
 };
 
+// Sectors whose data didn't change since their save slot was last written are not
+// written again, so they keep the counter of the save that last wrote them.
+// The manifest lists those counters, so that a slot whose save was interrupted
+// can't be mistaken for a complete one.
+struct SaveSlotManifest
+{
+    u32 signature;
+    u32 sectorCounters[NUM_SECTORS_PER_SLOT];
+};
+
 struct SaveSector
 {
     u8 data[SECTOR_DATA_SIZE];
-    u8 unused[SECTOR_FOOTER_SIZE - 12]; // Unused portion of the footer
+    struct SaveSlotManifest manifest; // Only used by the SaveBlock2 sector
+    u8 unused[SECTOR_FOOTER_SIZE - 12 - sizeof(struct SaveSlotManifest)]; // Unused portion of the footer
     u16 id;
     u16 checksum;
     u32 signature;
@@ -84,6 +100,7 @@ extern u32 gLastSaveCounter;
 extern u16 gLastKnownGoodSector;
 extern u32 gDamagedSaveSectors;
 extern u32 gSaveCounter;
+extern u8 gSaveSectorsWritten;
 extern struct SaveSector *gFastSaveSector;
 extern u16 gIncrementalSectorId;
 extern u16 gSaveFileStatus;
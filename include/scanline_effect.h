@@ -5,6 +5,15 @@
 #define SCANLINE_EFFECT_DMACNT_16BIT (((DMA_ENABLE | DMA_START_HBLANK | DMA_REPEAT | DMA_SRC_INC | DMA_DEST_INC | DMA_16BIT | DMA_DEST_RELOAD) << 16) | 1)
 #define SCANLINE_EFFECT_DMACNT_32BIT (((DMA_ENABLE | DMA_START_HBLANK | DMA_REPEAT | DMA_SRC_INC | DMA_DEST_INC | DMA_32BIT | DMA_DEST_RELOAD) << 16) | 1)
 
+// DMA control values to transfer 'count' consecutive registers at HBlank, e.g.
+// all of WIN0H through WINOUT. gScanlineEffectRegBuffers then holds 'count'
+// values per scanline, so at most 6 16-bit or 3 32-bit registers fit.
+#define SCANLINE_EFFECT_DMACNT_16BIT_REGS(count) ((SCANLINE_EFFECT_DMACNT_16BIT & ~0xFFFF) | (count))
+#define SCANLINE_EFFECT_DMACNT_32BIT_REGS(count) ((SCANLINE_EFFECT_DMACNT_32BIT & ~0xFFFF) | (count))
+
+// Registers written by the HBlank interrupt, in addition to the ones the DMA covers
+#define SCANLINE_EFFECT_MAX_IRQ_CHANNELS 4
+
 #define SCANLINE_EFFECT_REG_BG0HOFS (REG_ADDR_BG0HOFS - REG_ADDR_BG0HOFS)
 #define SCANLINE_EFFECT_REG_BG0VOFS (REG_ADDR_BG0VOFS - REG_ADDR_BG0HOFS)
 #define SCANLINE_EFFECT_REG_BG1HOFS (REG_ADDR_BG1HOFS - REG_ADDR_BG0HOFS)
@@ -30,19 +39,33 @@ struct ScanlineEffect
     void (*setFirstScanlineReg)(void);
     u8 srcBuffer;
     u8 state;
-    u8 unused16;
+    u8 unitsPerLine;
     u8 unused17;
     u8 waveTaskId;
 };
 
+// Work done for the last frame, so effects can judge how much they can add.
+struct ScanlineEffectStats
+{
+    u16 dmaUnits;    // values moved by the HBlank DMA
+    u16 irqWrites;   // registers written from the HBlank interrupt
+    u16 cpuLines;    // buffer entries rewritten by the CPU, e.g. by wave tasks
+    u8 irqChannels;
+};
+
 extern struct ScanlineEffect gScanlineEffect;
+extern struct ScanlineEffectStats gScanlineEffectStats;
 
 extern u16 gScanlineEffectRegBuffers[2][0x3C0];
+extern u16 gScanlineEffectIrqBuffers[2][SCANLINE_EFFECT_MAX_IRQ_CHANNELS][DISPLAY_HEIGHT];
 
 void ScanlineEffect_Stop(void);
 void ScanlineEffect_Clear(void);
 void ScanlineEffect_SetParams(struct ScanlineEffectParams);
 void ScanlineEffect_InitHBlankDmaTransfer(void);
+u8 ScanlineEffect_AddIrqChannel(volatile void *reg);
+void ScanlineEffect_HBlankCallback(void);
+void ScanlineEffect_AddCpuLines(u16 count);
 u8 ScanlineEffect_InitWave(u8 startLine, u8 endLine, u8 frequency, u8 amplitude, u8 delayInterval, u8 regOffset, bool8 applyBattleBgOffsets);
 
 #endif // GUARD_SCANLINE_EFFECT_H
@@ -50,6 +50,8 @@ void RunOnResumeMapScript(void);
 void RunOnReturnToFieldMapScript(void);
 void RunOnDiveWarpMapScript(void);
 bool8 TryRunOnFrameMapScript(void);
+void SetOnFrameMapScriptVarChanged(u16 varIndex);
+void RequestOnFrameMapScriptCheck(void);
 void TryRunOnWarpIntoMapScript(void);
 u32 CalculateRamScriptChecksum(void);
 void ClearRamScript(void);
@@ -5,6 +5,7 @@ void InitTilesetAnimations(void);
 void InitSecondaryTilesetAnimation(void);
 void UpdateTilesetAnimations(void);
 void TransferTilesetAnimsBuffer(void);
+void TrackTilesetAnimMetatile(u16 offset, const u16 *tiles);
 
 void InitTilesetAnim_General(void);
 void InitTilesetAnim_Petalburg(void);
@@ -26,11 +26,15 @@ struct WildPokemonHeader
     const struct WildPokemonInfo *fishingMonsInfo;
 };
 
+#define HEADER_NONE 0xFFFF
+
 extern const struct WildPokemonHeader gWildMonHeaders[];
+extern const u16 *const gWildMonHeaderIdsBySpecies[];
 extern bool8 gIsFishingEncounter;
 extern bool8 gIsSurfingEncounter;
 
 void DisableWildEncounters(bool8 disabled);
+u16 GetWildMonHeaderIdByMap(u8 mapGroup, u8 mapNum);
 bool8 StandardWildEncounter(u16 currMetaTileBehavior, u16 previousMetaTileBehavior);
 bool8 SweetScentWildEncounter(void);
 bool8 DoesCurrentMapHaveFishingMons(void);
@@ -480,7 +480,7 @@ static u8 ChooseMoveOrAction_Singles(void)
             }
         }
     }
-    return consideredMoveArray[Random() % numOfBestMoves];
+    return consideredMoveArray[RandomUniform(numOfBestMoves)];
 }
 
 static u8 ChooseMoveOrAction_Doubles(void)
@@ -564,7 +564,7 @@ static u8 ChooseMoveOrAction_Doubles(void)
                         }
                     }
                 }
-                actionOrMoveIndex[i] = mostViableMovesIndices[Random() % mostViableMovesNo];
+                actionOrMoveIndex[i] = mostViableMovesIndices[RandomUniform(mostViableMovesNo)];
                 bestMovePointsForTarget[i] = mostViableMovesScores[0];
 
                 // Don't use a move against ally if it has less than 100 points.
@@ -600,7 +600,7 @@ static u8 ChooseMoveOrAction_Doubles(void)
         }
     }
 
-    gBattlerTarget = mostViableTargetsArray[Random() % mostViableTargetsNo];
+    gBattlerTarget = mostViableTargetsArray[RandomUniform(mostViableTargetsNo)];
     gBattleStruct->aiChosenTarget[sBattler_AI] = gBattlerTarget;
     return actionOrMoveIndex[gBattlerTarget];
 }
@@ -1978,7 +1978,7 @@ static s16 AI_CheckBadMove(u8 battlerAtk, u8 battlerDef, u16 move, s16 score)
                     {
                         score -= 10; //Don't protect if you're going to faint after protecting
                     }
-                    else if (gDisableStructs[battlerAtk].protectUses == 1 && Random() % 100 < 50)
+                    else if (gDisableStructs[battlerAtk].protectUses == 1 && RandomUniform(100) < 50)
                     {
                         if (!isDoubleBattle)
                             score -= 6;
@@ -5236,7 +5236,7 @@ static s16 AI_Safari(u8 battlerAtk, u8 battlerDef, u16 move, s16 score)
 {
     u8 safariFleeRate = gBattleStruct->safariEscapeFactor * 5; // Safari flee rate, from 0-20.
 
-    if ((Random() % 100) < safariFleeRate)
+    if (RandomUniform(100) < safariFleeRate)
         AI_Flee();
     else
         AI_Watch();
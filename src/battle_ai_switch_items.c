@@ -118,7 +118,7 @@ static bool8 ShouldSwitchIfWonderGuard(void)
             move = GetMonData(&party[i], MON_DATA_MOVE1 + j);
             if (move != MOVE_NONE)
             {
-                if (AI_GetTypeEffectiveness(move, gActiveBattler, opposingBattler) >= UQ_4_12(2.0) && Random() % 3 < 2)
+                if (AI_GetTypeEffectiveness(move, gActiveBattler, opposingBattler) >= UQ_4_12(2.0) && RandomUniform(3) < 2)
                 {
                     // We found a mon.
                     *(gBattleStruct->AI_monToSwitchIntoId + gActiveBattler) = i;
@@ -141,7 +141,7 @@ static bool8 FindMonThatAbsorbsOpponentsMove(void)
     struct Pokemon *party;
     s32 i;
 
-    if (HasSuperEffectiveMoveAgainstOpponents(TRUE) && Random() % 3 != 0)
+    if (HasSuperEffectiveMoveAgainstOpponents(TRUE) && RandomUniform(3) != 0)
         return FALSE;
     if (gLastLandedMoves[gActiveBattler] == MOVE_NONE)
         return FALSE;
@@ -341,25 +341,25 @@ static bool8 ShouldSwitchIfGameStatePrompt(void)
             moduloChance = 2; //50%
             if (((gBattleMons[gActiveBattler].status1 & STATUS1_TOXIC_COUNTER) >= STATUS1_TOXIC_TURN(2))
                 && gBattleMons[gActiveBattler].hp >= (gBattleMons[gActiveBattler].maxHP / 3)
-                && (Random() % (moduloChance*chanceReducer)) == 0)
+                && RandomUniform(moduloChance*chanceReducer) == 0)
                 switchMon = TRUE;
             
             //Cursed
             moduloChance = 2; //50%
             if (gBattleMons[gActiveBattler].status2 & STATUS2_CURSED
-                && (Random() % (moduloChance*chanceReducer)) == 0)
+                && RandomUniform(moduloChance*chanceReducer) == 0)
                 switchMon = TRUE;
 
             //Nightmare
             moduloChance = 3; //33.3%
             if (gBattleMons[gActiveBattler].status2 & STATUS2_NIGHTMARE
-                && (Random() % (moduloChance*chanceReducer)) == 0)
+                && RandomUniform(moduloChance*chanceReducer) == 0)
                 switchMon = TRUE;
 
             //Leech Seed
             moduloChance = 4; //25%
             if (gStatuses3[gActiveBattler] & STATUS3_LEECHSEED
-                && (Random() % (moduloChance*chanceReducer)) == 0)
+                && RandomUniform(moduloChance*chanceReducer) == 0)
                 switchMon = TRUE;
         }
 
@@ -424,7 +424,7 @@ static bool8 ShouldSwitchIfAbilityBenefit(void)
             if ((gBattleMons[gActiveBattler].status1 & STATUS1_ANY)
                 && (gBattleMons[gActiveBattler].hp >= gBattleMons[gActiveBattler].maxHP / 2)
                 && GetMostSuitableMonToSwitchInto() != PARTY_SIZE
-                && Random() % (moduloChance*chanceReducer) == 0)
+                && RandomUniform(moduloChance*chanceReducer) == 0)
                 break;
 
             return FALSE;
@@ -436,7 +436,7 @@ static bool8 ShouldSwitchIfAbilityBenefit(void)
                 return FALSE;  
             if ((gBattleMons[gActiveBattler].hp <= ((gBattleMons[gActiveBattler].maxHP * 2) / 3))
                  && GetMostSuitableMonToSwitchInto() != PARTY_SIZE
-                 && Random() % (moduloChance*chanceReducer) == 0)
+                 && RandomUniform(moduloChance*chanceReducer) == 0)
                 break;
     
             return FALSE;
@@ -473,7 +473,7 @@ static bool8 HasSuperEffectiveMoveAgainstOpponents(bool8 noRng)
             {
                 if (noRng)
                     return TRUE;
-                if (Random() % 10 != 0)
+                if (RandomUniform(10) != 0)
                     return TRUE;
             }
         }
@@ -495,7 +495,7 @@ static bool8 HasSuperEffectiveMoveAgainstOpponents(bool8 noRng)
             {
                 if (noRng)
                     return TRUE;
-                if (Random() % 10 != 0)
+                if (RandomUniform(10) != 0)
                     return TRUE;
             }
         }
@@ -598,7 +598,7 @@ static bool8 FindMonWithFlagsAndSuperEffective(u16 flags, u8 moduloPercent)
                 if (move == 0)
                     continue;
 
-                if (AI_GetTypeEffectiveness(move, gActiveBattler, battlerIn1) >= UQ_4_12(2.0) && Random() % moduloPercent == 0)
+                if (AI_GetTypeEffectiveness(move, gActiveBattler, battlerIn1) >= UQ_4_12(2.0) && RandomUniform(moduloPercent) == 0)
                 {
                     *(gBattleStruct->AI_monToSwitchIntoId + gActiveBattler) = i;
                     BtlController_EmitTwoReturnValues(BUFFER_B, B_ACTION_SWITCH, 0);
@@ -781,32 +781,179 @@ void AI_TrySwitchOrUseItem(void)
     BtlController_EmitTwoReturnValues(BUFFER_B, B_ACTION_USE_MOVE, BATTLE_OPPOSITE(gActiveBattler) << 8);
 }
 
-// If there are two(or more) mons to choose from, always choose one that has baton pass
-// as most often it can't do much on its own.
-static u32 GetBestMonBatonPass(struct Pokemon *party, int firstId, int lastId, u8 invalidMons, int aliveCount)
+// Switch-in candidates for one battler. GetMostSuitableMonToSwitchInto is
+// called from several ShouldSwitchIf* checks and again by the controllers
+// within the same decision, so everything it derives from the bench is kept
+// here. The key holds the cheap-to-read state the table depends on; any change
+// in HP, party order, field or the opposing battler (including its held item
+// and statuses) makes it recompute.
+struct SwitchInCandidatesKey
+{
+    u32 partyPersonality[PARTY_SIZE];
+    u16 partyHp[PARTY_SIZE];
+    u32 fieldStatuses;
+    u32 sideStatuses[NUM_BATTLE_SIDES];
+    u32 opposingStatus1;
+    u32 opposingStatus2;
+    u32 opposingStatus3;
+    u16 weather;
+    u16 opposingSpecies;
+    u16 opposingHp;
+    u16 opposingAbility;
+    u16 opposingItem;
+    s8 opposingStatStages[NUM_BATTLE_STATS];
+    u8 opposingTypes[3];
+    u8 turn;
+    u8 opposingBattler;
+    u8 battlersIn[2];
+    u8 partyIndexes[2];
+    u8 switchIntoIds[2];
+};
+
+struct SwitchInCandidates
+{
+    struct SwitchInCandidatesKey key;
+    bool8 valid;
+    u8 invalidMons;
+    u8 aliveCount;
+    u8 batonPassMons;
+    u8 superEffectiveChecked;
+    u8 superEffectiveMons;
+    bool8 damageCalculated;
+    u32 typeMatchup[PARTY_SIZE];
+    s32 bestDamage[PARTY_SIZE];
+};
+
+EWRAM_DATA static struct SwitchInCandidates sSwitchInCandidates[MAX_BATTLERS_COUNT] = {0};
+
+void ClearSwitchInCandidates(void)
+{
+    memset(sSwitchInCandidates, 0, sizeof(sSwitchInCandidates));
+}
+
+static void GetSwitchInCandidatesKey(struct SwitchInCandidatesKey *key, struct Pokemon *party, u32 battlerIn1, u32 battlerIn2, u32 opposingBattler)
+{
+    s32 i;
+
+    // Zeroed so padding doesn't break the memcmp.
+    memset(key, 0, sizeof(*key));
+    for (i = 0; i < PARTY_SIZE; i++)
+    {
+        key->partyPersonality[i] = party[i].box.personality;
+        key->partyHp[i] = party[i].hp;
+    }
+    key->fieldStatuses = gFieldStatuses;
+    key->sideStatuses[B_SIDE_PLAYER] = gSideStatuses[B_SIDE_PLAYER];
+    key->sideStatuses[B_SIDE_OPPONENT] = gSideStatuses[B_SIDE_OPPONENT];
+    key->weather = gBattleWeather;
+    key->opposingSpecies = gBattleMons[opposingBattler].species;
+    key->opposingHp = gBattleMons[opposingBattler].hp;
+    key->opposingAbility = gBattleMons[opposingBattler].ability;
+    key->opposingItem = gBattleMons[opposingBattler].item;
+    key->opposingStatus1 = gBattleMons[opposingBattler].status1;
+    key->opposingStatus2 = gBattleMons[opposingBattler].status2;
+    key->opposingStatus3 = gStatuses3[opposingBattler];
+    memcpy(key->opposingStatStages, gBattleMons[opposingBattler].statStages, sizeof(key->opposingStatStages));
+    key->opposingTypes[0] = gBattleMons[opposingBattler].type1;
+    key->opposingTypes[1] = gBattleMons[opposingBattler].type2;
+    key->opposingTypes[2] = gBattleMons[opposingBattler].type3;
+    key->turn = gBattleResults.battleTurnCounter;
+    key->opposingBattler = opposingBattler;
+    key->battlersIn[0] = battlerIn1;
+    key->battlersIn[1] = battlerIn2;
+    key->partyIndexes[0] = gBattlerPartyIndexes[battlerIn1];
+    key->partyIndexes[1] = gBattlerPartyIndexes[battlerIn2];
+    key->switchIntoIds[0] = *(gBattleStruct->monToSwitchIntoId + battlerIn1);
+    key->switchIntoIds[1] = *(gBattleStruct->monToSwitchIntoId + battlerIn2);
+}
+
+static u32 GetMonTypeMatchup(struct Pokemon *mon, u32 opposingBattler)
+{
+    u16 species = GetMonData(mon, MON_DATA_SPECIES);
+    u32 typeEffectiveness = UQ_4_12(1.0);
+
+    u8 atkType1 = gBattleMons[opposingBattler].type1;
+    u8 atkType2 = gBattleMons[opposingBattler].type2;
+    u8 defType1 = gSpeciesInfo[species].types[0];
+    u8 defType2 = gSpeciesInfo[species].types[1];
+
+    typeEffectiveness *= GetTypeModifier(atkType1, defType1);
+    if (atkType2 != atkType1)
+        typeEffectiveness *= GetTypeModifier(atkType2, defType1);
+    if (defType2 != defType1)
+    {
+        typeEffectiveness *= GetTypeModifier(atkType1, defType2);
+        if (atkType2 != atkType1)
+            typeEffectiveness *= GetTypeModifier(atkType2, defType2);
+    }
+
+    return typeEffectiveness;
+}
+
+static struct SwitchInCandidates *GetSwitchInCandidates(struct Pokemon *party, int firstId, int lastId, u32 battlerIn1, u32 battlerIn2, u32 opposingBattler)
 {
-    int i, j, bits = 0;
+    struct SwitchInCandidates *candidates = &sSwitchInCandidates[gActiveBattler];
+    struct SwitchInCandidatesKey key;
+    s32 i, j;
 
+    GetSwitchInCandidatesKey(&key, party, battlerIn1, battlerIn2, opposingBattler);
+    if (candidates->valid && memcmp(&candidates->key, &key, sizeof(key)) == 0)
+        return candidates;
+
+    candidates->key = key;
+    candidates->valid = TRUE;
+    candidates->invalidMons = 0;
+    candidates->aliveCount = 0;
+    candidates->batonPassMons = 0;
+    candidates->superEffectiveChecked = 0;
+    candidates->superEffectiveMons = 0;
+    candidates->damageCalculated = FALSE;
+
+    // Get invalid slots ids.
     for (i = firstId; i < lastId; i++)
     {
-        if (invalidMons & gBitTable[i])
+        if (GetMonData(&party[i], MON_DATA_SPECIES) == SPECIES_NONE
+            || GetMonData(&party[i], MON_DATA_HP) == 0
+            || gBattlerPartyIndexes[battlerIn1] == i
+            || gBattlerPartyIndexes[battlerIn2] == i
+            || i == *(gBattleStruct->monToSwitchIntoId + battlerIn1)
+            || i == *(gBattleStruct->monToSwitchIntoId + battlerIn2)
+            || (GetMonAbility(&party[i]) == ABILITY_TRUANT && IsTruantMonVulnerable(gActiveBattler, opposingBattler)) // While not really invalid per say, not really wise to switch into this mon.
+            || ((AI_THINKING_STRUCT->aiFlags & AI_FLAG_ACE_POKEMON)
+                && i == (CalculateEnemyPartyCount() - 1))) //Save Ace Pokemon for last
+        {
+            candidates->invalidMons |= gBitTable[i];
             continue;
+        }
 
+        candidates->aliveCount++;
+        candidates->typeMatchup[i] = GetMonTypeMatchup(&party[i], opposingBattler);
         for (j = 0; j < MAX_MON_MOVES; j++)
         {
             if (GetMonData(&party[i], MON_DATA_MOVE1 + j, NULL) == MOVE_BATON_PASS)
             {
-                bits |= gBitTable[i];
+                candidates->batonPassMons |= gBitTable[i];
                 break;
             }
         }
     }
 
-    if ((aliveCount == 2 || (aliveCount > 2 && Random() % 3 == 0)) && bits)
+    return candidates;
+}
+
+// If there are two(or more) mons to choose from, always choose one that has baton pass
+// as most often it can't do much on its own.
+static u32 GetBestMonBatonPass(struct SwitchInCandidates *candidates, int firstId, int lastId)
+{
+    int i;
+    int aliveCount = candidates->aliveCount;
+    u8 bits = candidates->batonPassMons;
+
+    if ((aliveCount == 2 || (aliveCount > 2 && RandomUniform(3) == 0)) && bits)
     {
         do
         {
-            i = (Random() % (lastId - firstId)) + firstId;
+            i = RandomUniform(lastId - firstId) + firstId;
         } while (!(bits & gBitTable[i]));
         return i;
     }
@@ -814,9 +961,31 @@ static u32 GetBestMonBatonPass(struct Pokemon *party, int firstId, int lastId, u
     return PARTY_SIZE;
 }
 
-static u32 GetBestMonTypeMatchup(struct Pokemon *party, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
+static bool32 HasSuperEffectiveMove(struct SwitchInCandidates *candidates, struct Pokemon *party, u32 monId, u32 opposingBattler)
+{
+    u32 i;
+
+    if (!(candidates->superEffectiveChecked & gBitTable[monId]))
+    {
+        for (i = 0; i < MAX_MON_MOVES; i++)
+        {
+            u32 move = GetMonData(&party[monId], MON_DATA_MOVE1 + i);
+            if (move != MOVE_NONE && AI_GetTypeEffectiveness(move, gActiveBattler, opposingBattler) >= UQ_4_12(2.0))
+            {
+                candidates->superEffectiveMons |= gBitTable[monId];
+                break;
+            }
+        }
+        candidates->superEffectiveChecked |= gBitTable[monId];
+    }
+
+    return (candidates->superEffectiveMons & gBitTable[monId]) != 0;
+}
+
+static u32 GetBestMonTypeMatchup(struct SwitchInCandidates *candidates, struct Pokemon *party, int firstId, int lastId, u32 opposingBattler)
 {
     int i, bits = 0;
+    u8 invalidMons = candidates->invalidMons;
 
     while (bits != 0x3F) // All mons were checked.
     {
@@ -827,26 +996,9 @@ static u32 GetBestMonTypeMatchup(struct Pokemon *party, int firstId, int lastId,
         {
             if (!(gBitTable[i] & invalidMons) && !(gBitTable[i] & bits))
             {
-                u16 species = GetMonData(&party[i], MON_DATA_SPECIES);
-                u32 typeEffectiveness = UQ_4_12(1.0);
-
-                u8 atkType1 = gBattleMons[opposingBattler].type1;
-                u8 atkType2 = gBattleMons[opposingBattler].type2;
-                u8 defType1 = gSpeciesInfo[species].types[0];
-                u8 defType2 = gSpeciesInfo[species].types[1];
-
-                typeEffectiveness *= GetTypeModifier(atkType1, defType1);
-                if (atkType2 != atkType1)
-                    typeEffectiveness *= GetTypeModifier(atkType2, defType1);
-                if (defType2 != defType1)
-                {
-                    typeEffectiveness *= GetTypeModifier(atkType1, defType2);
-                    if (atkType2 != atkType1)
-                        typeEffectiveness *= GetTypeModifier(atkType2, defType2);
-                }
-                if (typeEffectiveness < bestResist)
+                if (candidates->typeMatchup[i] < bestResist)
                 {
-                    bestResist = typeEffectiveness;
+                    bestResist = candidates->typeMatchup[i];
                     bestMonId = i;
                 }
             }
@@ -855,14 +1007,7 @@ static u32 GetBestMonTypeMatchup(struct Pokemon *party, int firstId, int lastId,
         // Ok, we know the mon has the right typing but does it have at least one super effective move?
         if (bestMonId != PARTY_SIZE)
         {
-            for (i = 0; i < MAX_MON_MOVES; i++)
-            {
-                u32 move = GetMonData(&party[bestMonId], MON_DATA_MOVE1 + i);
-                if (move != MOVE_NONE && AI_GetTypeEffectiveness(move, gActiveBattler, opposingBattler) >= UQ_4_12(2.0))
-                    break;
-            }
-
-            if (i != MAX_MON_MOVES)
+            if (HasSuperEffectiveMove(candidates, party, bestMonId, opposingBattler))
                 return bestMonId; // Has both the typing and at least one super effective move.
 
             bits |= gBitTable[bestMonId]; // Sorry buddy, we want something better.
@@ -876,32 +1021,46 @@ static u32 GetBestMonTypeMatchup(struct Pokemon *party, int firstId, int lastId,
     return PARTY_SIZE;
 }
 
-static u32 GetBestMonDmg(struct Pokemon *party, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
+static u32 GetBestMonDmg(struct SwitchInCandidates *candidates, struct Pokemon *party, int firstId, int lastId, u32 opposingBattler)
 {
     int i, j;
     int bestDmg = 0;
     int bestMonId = PARTY_SIZE;
 
     gMoveResultFlags = 0;
-    // If we couldn't find the best mon in terms of typing, find the one that deals most damage.
-    for (i = firstId; i < lastId; i++)
+    if (!candidates->damageCalculated)
     {
-        if (gBitTable[i] & invalidMons)
-            continue;
-
-        for (j = 0; j < MAX_MON_MOVES; j++)
+        for (i = firstId; i < lastId; i++)
         {
-            u32 move = GetMonData(&party[i], MON_DATA_MOVE1 + j);
-            if (move != MOVE_NONE && gBattleMoves[move].power != 0)
+            candidates->bestDamage[i] = 0;
+            if (gBitTable[i] & candidates->invalidMons)
+                continue;
+
+            for (j = 0; j < MAX_MON_MOVES; j++)
             {
-                s32 dmg = AI_CalcPartyMonDamage(move, gActiveBattler, opposingBattler, &party[i]);
-                if (bestDmg < dmg)
+                u32 move = GetMonData(&party[i], MON_DATA_MOVE1 + j);
+                if (move != MOVE_NONE && gBattleMoves[move].power != 0)
                 {
-                    bestDmg = dmg;
-                    bestMonId = i;
+                    s32 dmg = AI_CalcPartyMonDamage(move, gActiveBattler, opposingBattler, &party[i]);
+                    if (candidates->bestDamage[i] < dmg)
+                        candidates->bestDamage[i] = dmg;
                 }
             }
         }
+        candidates->damageCalculated = TRUE;
+    }
+
+    // If we couldn't find the best mon in terms of typing, find the one that deals most damage.
+    for (i = firstId; i < lastId; i++)
+    {
+        if (gBitTable[i] & candidates->invalidMons)
+            continue;
+
+        if (bestDmg < candidates->bestDamage[i])
+        {
+            bestDmg = candidates->bestDamage[i];
+            bestMonId = i;
+        }
     }
 
     return bestMonId;
@@ -915,8 +1074,7 @@ u8 GetMostSuitableMonToSwitchInto(void)
     s32 firstId = 0;
     s32 lastId = 0; // + 1
     struct Pokemon *party;
-    s32 i, j, aliveCount = 0;
-    u8 invalidMons = 0;
+    struct SwitchInCandidates *candidates;
 
     if (*(gBattleStruct->monToSwitchIntoId + gActiveBattler) != PARTY_SIZE)
         return *(gBattleStruct->monToSwitchIntoId + gActiveBattler);
@@ -949,32 +1107,17 @@ u8 GetMostSuitableMonToSwitchInto(void)
     else
         party = gEnemyParty;
 
-    // Get invalid slots ids.
-    for (i = firstId; i < lastId; i++)
-    {
-        if (GetMonData(&party[i], MON_DATA_SPECIES) == SPECIES_NONE
-            || GetMonData(&party[i], MON_DATA_HP) == 0
-            || gBattlerPartyIndexes[battlerIn1] == i
-            || gBattlerPartyIndexes[battlerIn2] == i
-            || i == *(gBattleStruct->monToSwitchIntoId + battlerIn1)
-            || i == *(gBattleStruct->monToSwitchIntoId + battlerIn2)
-            || (GetMonAbility(&party[i]) == ABILITY_TRUANT && IsTruantMonVulnerable(gActiveBattler, opposingBattler)) // While not really invalid per say, not really wise to switch into this mon.
-            || ((AI_THINKING_STRUCT->aiFlags & AI_FLAG_ACE_POKEMON)
-                && i == (CalculateEnemyPartyCount() - 1))) //Save Ace Pokemon for last
-            invalidMons |= gBitTable[i];
-        else
-            aliveCount++;
-    }
+    candidates = GetSwitchInCandidates(party, firstId, lastId, battlerIn1, battlerIn2, opposingBattler);
 
-    bestMonId = GetBestMonBatonPass(party, firstId, lastId, invalidMons, aliveCount);
+    bestMonId = GetBestMonBatonPass(candidates, firstId, lastId);
     if (bestMonId != PARTY_SIZE)
         return bestMonId;
 
-    bestMonId = GetBestMonTypeMatchup(party, firstId, lastId, invalidMons, opposingBattler);
+    bestMonId = GetBestMonTypeMatchup(candidates, party, firstId, lastId, opposingBattler);
     if (bestMonId != PARTY_SIZE)
         return bestMonId;
 
-    bestMonId = GetBestMonDmg(party, firstId, lastId, invalidMons, opposingBattler);
+    bestMonId = GetBestMonDmg(candidates, party, firstId, lastId, opposingBattler);
     if (bestMonId != PARTY_SIZE)
         return bestMonId;
 
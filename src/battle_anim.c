@@ -25,6 +25,13 @@
 */
 
 #define ANIM_SPRITE_INDEX_COUNT 8
+#define ANIM_GFX_CACHE_COUNT 16
+
+struct AnimGfxCacheEntry
+{
+    u16 index;
+    u32 lastUsed;
+};
 
 extern const u16 gMovesWithQuietBGM[];
 extern const u8 *const gBattleAnims_Moves[];
@@ -88,6 +95,7 @@ static void Task_PanFromInitialToTarget(u8 taskId);
 static void Task_LoopAndPlaySE(u8 taskId);
 static void Task_WaitAndPlaySE(u8 taskId);
 static void LoadDefaultBg(void);
+static bool8 ReclaimAnimSpriteTiles(void);
 
 EWRAM_DATA static const u8 *sBattleAnimScriptPtr = NULL;
 EWRAM_DATA static const u8 *sBattleAnimScriptRetAddr = NULL;
@@ -112,6 +120,10 @@ EWRAM_DATA u8 gBattleAnimAttacker = 0;
 EWRAM_DATA u8 gBattleAnimTarget = 0;
 EWRAM_DATA u16 gAnimBattlerSpecies[MAX_BATTLERS_COUNT] = {0};
 EWRAM_DATA u8 gAnimCustomPanning = 0;
+EWRAM_DATA static struct AnimGfxCacheEntry sAnimGfxCache[ANIM_GFX_CACHE_COUNT] = {0};
+EWRAM_DATA static u32 sAnimGfxCacheClock = 0;
+EWRAM_DATA u32 gAnimGfxCacheHits = 0;
+EWRAM_DATA u32 gAnimGfxCacheMisses = 0;
 
 #include "data/battle_anim.h"
 
@@ -196,6 +208,11 @@ void ClearBattleAnimationVars(void)
     gBattleAnimAttacker = 0;
     gBattleAnimTarget = 0;
     gAnimCustomPanning = 0;
+
+    FlushBattleAnimGfxCache();
+    gAnimGfxCacheHits = 0;
+    gAnimGfxCacheMisses = 0;
+    SetSpriteTileReclaimFunc(ReclaimAnimSpriteTiles);
 }
 
 void DoMoveAnim(u16 move)
@@ -341,6 +358,128 @@ static void ClearSpriteIndex(u16 index)
     }
 }
 
+// Sprite sheets loaded by anim scripts stay in VRAM after they're unloaded,
+// so a move used again doesn't have to decompress and copy them again.
+// Sheets in sAnimSpriteIndexArray are in use and never evicted; the others
+// are freed least recently used first when sprite tiles run out.
+static bool8 IsSpriteIndexInUse(u16 index)
+{
+    s32 i;
+
+    for (i = 0; i < ANIM_SPRITE_INDEX_COUNT; i++)
+    {
+        if (sAnimSpriteIndexArray[i] == index)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static s32 GetAnimGfxCacheSlot(u16 index)
+{
+    s32 i;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        if (sAnimGfxCache[i].index == index)
+        {
+            // The tiles may have been freed behind the cache's back.
+            if (GetSpriteTileStartByTag(gBattleAnimPicTable[index].tag) != 0xFFFF)
+                return i;
+            sAnimGfxCache[i].index = 0xFFFF;
+            return -1;
+        }
+    }
+    return -1;
+}
+
+static s32 GetLeastRecentlyUsedAnimGfxCacheSlot(void)
+{
+    s32 i;
+    s32 slot = -1;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        if (sAnimGfxCache[i].index == 0xFFFF || IsSpriteIndexInUse(sAnimGfxCache[i].index))
+            continue;
+        if (slot == -1 || sAnimGfxCache[i].lastUsed < sAnimGfxCache[slot].lastUsed)
+            slot = i;
+    }
+    return slot;
+}
+
+static void EvictAnimGfxCacheSlot(s32 slot)
+{
+    u16 tag = gBattleAnimPicTable[sAnimGfxCache[slot].index].tag;
+
+    if (GetSpriteTileStartByTag(tag) != 0xFFFF)
+        FreeSpriteTilesByTag(tag);
+    sAnimGfxCache[slot].index = 0xFFFF;
+}
+
+static bool8 ReclaimAnimSpriteTiles(void)
+{
+    s32 slot = GetLeastRecentlyUsedAnimGfxCacheSlot();
+
+    if (slot == -1)
+        return FALSE;
+
+    EvictAnimGfxCacheSlot(slot);
+    return TRUE;
+}
+
+static void LoadAnimSpriteSheet(u16 index)
+{
+    s32 slot = GetAnimGfxCacheSlot(index);
+
+    if (slot != -1)
+    {
+        gAnimGfxCacheHits++;
+    }
+    else
+    {
+        gAnimGfxCacheMisses++;
+        LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[index]);
+        if (GetSpriteTileStartByTag(gBattleAnimPicTable[index].tag) == 0xFFFF)
+            return;
+
+        for (slot = 0; slot < ANIM_GFX_CACHE_COUNT; slot++)
+        {
+            if (sAnimGfxCache[slot].index == 0xFFFF)
+                break;
+        }
+        if (slot == ANIM_GFX_CACHE_COUNT)
+        {
+            slot = GetLeastRecentlyUsedAnimGfxCacheSlot();
+            if (slot == -1)
+                return;
+            EvictAnimGfxCacheSlot(slot);
+        }
+        sAnimGfxCache[slot].index = index;
+    }
+    sAnimGfxCache[slot].lastUsed = ++sAnimGfxCacheClock;
+}
+
+static void UnloadAnimSpriteGfx(u16 index)
+{
+    // Sheets that didn't fit in the cache are freed right away.
+    if (GetAnimGfxCacheSlot(index) == -1)
+        FreeSpriteTilesByTag(gBattleAnimPicTable[index].tag);
+    FreeSpritePaletteByTag(gBattleAnimPicTable[index].tag);
+}
+
+void FlushBattleAnimGfxCache(void)
+{
+    s32 i;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        if (sAnimGfxCache[i].index != 0xFFFF)
+            EvictAnimGfxCacheSlot(i);
+    }
+    sAnimGfxCacheClock = 0;
+    SetSpriteTileReclaimFunc(NULL);
+}
+
 static void WaitAnimFrameCount(void)
 {
     if (sAnimFramesToWait <= 0)
@@ -368,7 +507,7 @@ static void Cmd_loadspritegfx(void)
 
     sBattleAnimScriptPtr++;
     index = T1_READ_16(sBattleAnimScriptPtr);
-    LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)]);
+    LoadAnimSpriteSheet(GET_TRUE_SPRITE_INDEX(index));
     LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[GET_TRUE_SPRITE_INDEX(index)]);
     sBattleAnimScriptPtr += 2;
     AddSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
@@ -382,10 +521,9 @@ static void Cmd_unloadspritegfx(void)
 
     sBattleAnimScriptPtr++;
     index = T1_READ_16(sBattleAnimScriptPtr);
-    FreeSpriteTilesByTag(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
-    FreeSpritePaletteByTag(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
     sBattleAnimScriptPtr += 2;
     ClearSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
+    UnloadAnimSpriteGfx(GET_TRUE_SPRITE_INDEX(index));
 }
 
 static void Cmd_createsprite(void)
@@ -540,9 +678,9 @@ static void Cmd_end(void)
     {
         if (sAnimSpriteIndexArray[i] != 0xFFFF)
         {
-            FreeSpriteTilesByTag(gBattleAnimPicTable[sAnimSpriteIndexArray[i]].tag);
-            FreeSpritePaletteByTag(gBattleAnimPicTable[sAnimSpriteIndexArray[i]].tag);
+            u16 index = sAnimSpriteIndexArray[i];
             sAnimSpriteIndexArray[i] = 0xFFFF; // set terminator.
+            UnloadAnimSpriteGfx(index);
         }
     }
 
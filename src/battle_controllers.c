@@ -60,6 +60,7 @@ void SetUpBattleVarsAndBirchZigzagoon(void)
     ClearBattleMonForms();
     BattleAI_SetupItems();
 	BattleAI_SetupFlags();
+    ClearSwitchInCandidates();
 
     if (gBattleTypeFlags & BATTLE_TYPE_FIRST_BATTLE)
     {
@@ -59,6 +59,15 @@ struct TourneyTreeLineSection
     u16 src;
 };
 
+// Window settings for the scanlines up to (but not including) endLine
+struct TourneyTreeWindowBand
+{
+    u8 endLine;
+    u16 winIn;
+    u16 win0H;
+    u16 win1H;
+};
+
 #define DOME_TRAINERS gSaveBlock2Ptr->frontier.domeTrainers
 #define DOME_MONS     gSaveBlock2Ptr->frontier.domeMonIds
 
@@ -102,7 +111,7 @@ static u8 GetDomeBrainTrainerPicId(void);
 static u8 GetDomeBrainTrainerClass(void);
 static void CopyDomeBrainTrainerName(u8 *);
 static void CopyDomeTrainerName(u8 *, u16);
-static void HblankCb_TourneyTree(void);
+static void InitTourneyTreeWindowChannels(void);
 static void VblankCb_TourneyTree(void);
 static u8 UpdateTourneyTreeCursor(u8);
 static void DecideRoundWinners(u8);
@@ -876,6 +885,29 @@ static const struct ScanlineEffectParams sTourneyTreeScanlineEffectParams =
     .initState = 1,
 };
 
+#define TOURNEY_WININ_ALL    (WININ_WIN0_BG_ALL | WININ_WIN0_CLR | WININ_WIN0_OBJ \
+                            | WININ_WIN1_BG_ALL | WININ_WIN1_CLR | WININ_WIN1_OBJ)
+#define TOURNEY_WININ_NO_BG2 (WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG3 | WININ_WIN0_OBJ | WININ_WIN0_CLR \
+                            | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG3 | WININ_WIN1_OBJ | WININ_WIN1_CLR)
+#define TOURNEY_WININ_NO_BG3 (WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG2 | WININ_WIN0_OBJ | WININ_WIN0_CLR \
+                            | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG2 | WININ_WIN1_OBJ | WININ_WIN1_CLR)
+
+// Windows over the center of the tree, which hide one of the scrolling BGs
+static const struct TourneyTreeWindowBand sTourneyTreeWindowBands[] =
+{
+    {42,             TOURNEY_WININ_ALL,    0,                 0},
+    {50,             TOURNEY_WININ_NO_BG2, WIN_RANGE(85, 88), WIN_RANGE(152, 155)},
+    {58,             TOURNEY_WININ_ALL,    0,                 0},
+    {75,             TOURNEY_WININ_NO_BG2, WIN_RANGE(88, 96), WIN_RANGE(144, 152)},
+    {82,             TOURNEY_WININ_NO_BG2, WIN_RANGE(85, 88), WIN_RANGE(152, 155)},
+    {95,             TOURNEY_WININ_ALL,    0,                 0},
+    {103,            TOURNEY_WININ_NO_BG3, WIN_RANGE(85, 88), WIN_RANGE(152, 155)},
+    {119,            TOURNEY_WININ_NO_BG3, WIN_RANGE(88, 96), WIN_RANGE(144, 152)},
+    {127,            TOURNEY_WININ_ALL,    0,                 0},
+    {135,            TOURNEY_WININ_NO_BG3, WIN_RANGE(85, 88), WIN_RANGE(152, 155)},
+    {DISPLAY_HEIGHT, TOURNEY_WININ_ALL,    0,                 0},
+};
+
 static const struct CompressedSpriteSheet sTourneyTreeButtonsSpriteSheet[] =
 {
     {gDomeTourneyTreeButtons_Gfx, 0x0600, 0x0000},
@@ -2239,19 +2271,15 @@ static void SetDomeData(void)
 
 static void InitDomeTrainers(void)
 {
-    int i, j, k;
+    int i, j;
     int monLevel;
-    int species[FRONTIER_PARTY_SIZE];
+    struct FrontierMonPool *pool;
     int monTypesBits, monTypesCount;
     int trainerId;
-    int monId;
     u16 *rankingScores;
     int *statValues;
     u8 ivs = 0;
 
-    species[0] = 0;
-    species[1] = 0;
-    species[2] = 0;
     rankingScores = AllocZeroed(sizeof(u16) * DOME_TOURNAMENT_TRAINERS_COUNT);
     statValues = AllocZeroed(sizeof(int) * NUM_STATS);
 
@@ -2306,26 +2334,16 @@ static void InitDomeTrainers(void)
         }
 
         // Choose party
+        pool = CreateFrontierMonPool();
+        SetFrontierMonPoolItemNoneUnique(pool);
+        AddFrontierTrainerMonsToPool(pool, trainerId);
         for (j = 0; j < FRONTIER_PARTY_SIZE; j++)
         {
-            do
-            {
-                monId = GetRandomFrontierMonFromSet(trainerId);
-                for (k = 0; k < j; k++)
-                {
-                    // Make sure the mon is valid.
-                    int alreadySelectedMonId = DOME_MONS[i][k];
-                    if (alreadySelectedMonId == monId
-                        || species[0] == gFacilityTrainerMons[monId].species
-                        || species[1] == gFacilityTrainerMons[monId].species
-                        || gFacilityTrainerMons[alreadySelectedMonId].itemTableId == gFacilityTrainerMons[monId].itemTableId)
-                        break;
-                }
-            } while (k != j);
-
-            DOME_MONS[i][j] = monId;
-            species[j] = gFacilityTrainerMons[monId].species;
+            DOME_MONS[i][j] = DrawFrontierMonFromPool(pool);
+            if (DOME_MONS[i][j] == 0xFFFF)
+                DOME_MONS[i][j] = GetRandomFrontierMonFromSet(trainerId);
         }
+        DestroyFrontierMonPool(pool);
 
         DOME_TRAINERS[i].isEliminated = FALSE;
         DOME_TRAINERS[i].eliminatedAt = 0;
@@ -5442,7 +5460,6 @@ static void Task_ShowTourneyTree(u8 taskId)
         CopyWindowToVram(0, COPYWIN_FULL);
         CopyWindowToVram(1, COPYWIN_FULL);
         CopyWindowToVram(2, COPYWIN_FULL);
-        SetHBlankCallback(HblankCb_TourneyTree);
         SetVBlankCallback(VblankCb_TourneyTree);
         if (r4 == 2)
         {
@@ -5482,6 +5499,7 @@ static void Task_ShowTourneyTree(u8 taskId)
         }
 
         ScanlineEffect_SetParams(sTourneyTreeScanlineEffectParams);
+        InitTourneyTreeWindowChannels();
         DestroyTask(taskId);
         break;
     }
@@ -5607,80 +5625,31 @@ static void VblankCb_TourneyInfoCard(void)
     TransferPlttBuffer();
 }
 
-#define SET_WIN0H_WIN1H(win0H, win1H)                       \
-{                                                           \
-    *(vu32*)(REG_ADDR_WIN0H) = ((win0H << 16) | (win1H));   \
-}
-
-static void HblankCb_TourneyTree(void)
+// The BG3CNT DMA switches BG priority halfway down the screen, and the
+// window registers aren't next to it, so they're written per scanline from
+// the HBlank interrupt instead.
+static void InitTourneyTreeWindowChannels(void)
 {
-    u16 vCount = REG_VCOUNT;
+    u8 winIn = ScanlineEffect_AddIrqChannel(&REG_WININ);
+    u8 win0H = ScanlineEffect_AddIrqChannel(&REG_WIN0H);
+    u8 win1H = ScanlineEffect_AddIrqChannel(&REG_WIN1H);
+    u32 line, band, i;
 
-    if (vCount < 42)
-    {
-        REG_WININ = WININ_WIN0_BG_ALL | WININ_WIN0_CLR | WININ_WIN0_OBJ
-                | WININ_WIN1_BG_ALL | WININ_WIN1_CLR | WININ_WIN1_OBJ;
-        SET_WIN0H_WIN1H(0, 0);
-    }
-    else if (vCount < 50)
-    {
-        REG_WININ = WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG3 | WININ_WIN0_OBJ | WININ_WIN0_CLR
-                    | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG3 | WININ_WIN1_OBJ | WININ_WIN1_CLR;
-        SET_WIN0H_WIN1H(WIN_RANGE(152, 155), WIN_RANGE(85, 88));
-    }
-    else if (vCount < 58)
-    {
-        REG_WININ = WININ_WIN0_BG_ALL | WININ_WIN0_CLR | WININ_WIN0_OBJ
-                | WININ_WIN1_BG_ALL | WININ_WIN1_CLR | WININ_WIN1_OBJ;
-        SET_WIN0H_WIN1H(0, 0);
-    }
-    else if (vCount < 75)
+    for (line = 0; line < DISPLAY_HEIGHT; line++)
     {
-        REG_WININ = WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG3 | WININ_WIN0_OBJ | WININ_WIN0_CLR
-                    | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG3 | WININ_WIN1_OBJ | WININ_WIN1_CLR;
-        SET_WIN0H_WIN1H(WIN_RANGE(144, 152), WIN_RANGE(88, 96));
-    }
-    else if (vCount < 82)
-    {
-        REG_WININ = WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG3 | WININ_WIN0_OBJ | WININ_WIN0_CLR
-                    | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG3 | WININ_WIN1_OBJ | WININ_WIN1_CLR;
-        SET_WIN0H_WIN1H(WIN_RANGE(152, 155), WIN_RANGE(85, 88));
-    }
-    else if (vCount < 95)
-    {
-        REG_WININ = WININ_WIN0_BG_ALL | WININ_WIN0_CLR | WININ_WIN0_OBJ
-                | WININ_WIN1_BG_ALL | WININ_WIN1_CLR | WININ_WIN1_OBJ;
-        SET_WIN0H_WIN1H(0, 0);
-    }
-    else if (vCount < 103)
-    {
-        REG_WININ = WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG2 | WININ_WIN0_OBJ | WININ_WIN0_CLR
-                    | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG2 | WININ_WIN1_OBJ | WININ_WIN1_CLR;
-        SET_WIN0H_WIN1H(WIN_RANGE(152, 155), WIN_RANGE(85, 88));
-    }
-    else if (vCount < 119)
-    {
-        REG_WININ = WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG2 | WININ_WIN0_OBJ | WININ_WIN0_CLR
-                    | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG2 | WININ_WIN1_OBJ | WININ_WIN1_CLR;
-        SET_WIN0H_WIN1H(WIN_RANGE(144, 152), WIN_RANGE(88, 96));
-    }
-    else if (vCount < 127)
-    {
-        REG_WININ = WININ_WIN0_BG_ALL | WININ_WIN0_CLR | WININ_WIN0_OBJ
-                | WININ_WIN1_BG_ALL | WININ_WIN1_CLR | WININ_WIN1_OBJ;
-        SET_WIN0H_WIN1H(0, 0);
-    }
-    else if (vCount < 135)
-    {
-        REG_WININ = WININ_WIN0_BG0 | WININ_WIN0_BG1 | WININ_WIN0_BG2 | WININ_WIN0_OBJ | WININ_WIN0_CLR
-                    | WININ_WIN1_BG0 | WININ_WIN1_BG1 | WININ_WIN1_BG2 | WININ_WIN1_OBJ | WININ_WIN1_CLR;
-        SET_WIN0H_WIN1H(WIN_RANGE(152, 155), WIN_RANGE(85, 88));
-    }
-    else
-    {
-        REG_WININ = WININ_WIN0_BG_ALL | WININ_WIN0_CLR | WININ_WIN0_OBJ
-                | WININ_WIN1_BG_ALL | WININ_WIN1_CLR | WININ_WIN1_OBJ;
-        SET_WIN0H_WIN1H(0, 0);
+        // Each line gets the band of the line above it, as when this was
+        // written from the HBlank before it. Line 0 follows VBlank, which is
+        // past the last band.
+        u32 prevLine = (line == 0) ? DISPLAY_HEIGHT - 1 : line - 1;
+
+        for (band = 0; prevLine >= sTourneyTreeWindowBands[band].endLine; band++)
+            ;
+        for (i = 0; i < 2; i++)
+        {
+            gScanlineEffectIrqBuffers[i][winIn][line] = sTourneyTreeWindowBands[band].winIn;
+            gScanlineEffectIrqBuffers[i][win0H][line] = sTourneyTreeWindowBands[band].win0H;
+            gScanlineEffectIrqBuffers[i][win1H][line] = sTourneyTreeWindowBands[band].win1H;
+        }
     }
 }
 
@@ -5772,12 +5741,11 @@ static void BufferLastDomeWinnerName(void)
 // For showing the previous tourney results before the player has entered a challenge
 static void InitRandomTourneyTreeResults(void)
 {
-    int i, j, k;
+    int i, j;
     int monLevel;
-    int species[FRONTIER_PARTY_SIZE];
+    struct FrontierMonPool *pool;
     int monTypesBits;
     int trainerId;
-    int monId;
     int zero1;
     int zero2;
     u8 lvlMode;
@@ -5785,9 +5753,6 @@ static void InitRandomTourneyTreeResults(void)
     int *statValues;
     u8 ivs = 0;
 
-    species[0] = 0;
-    species[1] = 0;
-    species[2] = 0;
     if ((gSaveBlock2Ptr->frontier.domeLvlMode != -gSaveBlock2Ptr->frontier.domeBattleMode) && gSaveBlock2Ptr->frontier.challengeStatus != CHALLENGE_STATUS_SAVING)
         return;
 
@@ -5820,26 +5785,16 @@ static void InitRandomTourneyTreeResults(void)
         } while (j != i);
 
         DOME_TRAINERS[i].trainerId = trainerId;
+        pool = CreateFrontierMonPool();
+        SetFrontierMonPoolItemNoneUnique(pool);
+        AddFrontierTrainerMonsToPool(pool, trainerId);
         for (j = 0; j < FRONTIER_PARTY_SIZE; j++)
         {
-            do
-            {
-                monId = GetRandomFrontierMonFromSet(trainerId);
-                for (k = 0; k < j; k++)
-                {
-                    // Make sure the mon is valid.
-                    int alreadySelectedMonId = DOME_MONS[i][k];
-                    if (alreadySelectedMonId == monId
-                        || species[0] == gFacilityTrainerMons[monId].species
-                        || species[1] == gFacilityTrainerMons[monId].species
-                        || gFacilityTrainerMons[alreadySelectedMonId].itemTableId == gFacilityTrainerMons[monId].itemTableId)
-                        break;
-                }
-            } while (k != j);
-
-            DOME_MONS[i][j] = monId;
-            species[j] = gFacilityTrainerMons[monId].species;
+            DOME_MONS[i][j] = DrawFrontierMonFromPool(pool);
+            if (DOME_MONS[i][j] == 0xFFFF)
+                DOME_MONS[i][j] = GetRandomFrontierMonFromSet(trainerId);
         }
+        DestroyFrontierMonPool(pool);
         DOME_TRAINERS[i].isEliminated = FALSE;
         DOME_TRAINERS[i].eliminatedAt = 0;
         DOME_TRAINERS[i].forfeited = FALSE;
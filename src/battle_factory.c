@@ -39,6 +39,8 @@ static void GetOpponentMostCommonMonType(void);
 static void GetOpponentBattleStyle(void);
 static void RestorePlayerPartyHeldItems(void);
 static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange);
+static u16 GetFactoryOpponentMonId(u8 lvlMode, u8 challengeNum);
+static void GetFactoryMonIdRange(u8 lvlMode, u8 challengeNum, bool8 useBetterRange, u16 *firstMonId, u16 *lastMonId);
 static u8 GetMoveBattleStyle(u16 move);
 
 // Number of moves needed on the team to be considered using a certain battle style
@@ -302,11 +304,10 @@ static void SetPerformedRentalSwap(void)
 
 static void GenerateOpponentMons(void)
 {
-    int i, j, k;
-    u16 species[FRONTIER_PARTY_SIZE];
-    u16 heldItems[FRONTIER_PARTY_SIZE];
-    int firstMonId = 0;
+    int i;
     u16 trainerId = 0;
+    u16 monId, firstMonId, lastMonId;
+    struct FrontierMonPool *pool;
     u32 lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     u32 battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
     u32 winStreak = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode];
@@ -328,52 +329,33 @@ static void GenerateOpponentMons(void)
     if (gSaveBlock2Ptr->frontier.curChallengeBattleNum < FRONTIER_STAGES_PER_CHALLENGE - 1)
         gSaveBlock2Ptr->frontier.trainerIds[gSaveBlock2Ptr->frontier.curChallengeBattleNum] = trainerId;
 
-    i = 0;
-    while (i != FRONTIER_PARTY_SIZE)
+    pool = CreateFrontierMonPool();
+    GetFactoryMonIdRange(lvlMode, challengeNum, FALSE, &firstMonId, &lastMonId);
+    for (monId = firstMonId; monId <= lastMonId; monId++)
     {
-        u16 monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
-
         // Unown (FRONTIER_MON_UNOWN) is forbidden on opponent Factory teams.
         if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
             continue;
 
-        // Ensure none of the opponent's pokemon are the same as the potential rental pokemon for the player
-        for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
-        {
-            if (gFacilityTrainerMons[monId].species == gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[j].monId].species)
-                break;
-        }
-        if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
-            continue;
-
         // "High tier" pokemon are only allowed on open level mode
         if (lvlMode == FRONTIER_LVL_50 && monId > FRONTIER_MONS_HIGH_TIER)
             continue;
 
-        // Ensure this species hasn't already been chosen for the opponent
-        for (k = firstMonId; k < firstMonId + i; k++)
-        {
-            if (species[k] == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (k != firstMonId + i)
-            continue;
+        AddFrontierMonPoolCandidate(pool, monId);
+    }
 
-        // Ensure held items don't repeat on the opponent's team
-        for (k = firstMonId; k < firstMonId + i; k++)
-        {
-            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (k != firstMonId + i)
-            continue;
+    // Ensure none of the opponent's pokemon are the same as the potential rental pokemon for the player
+    for (i = 0; i < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); i++)
+        MarkFrontierMonPoolUsed(pool, gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[i].monId].species, ITEM_NONE);
 
-        // Successful selection
-        species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
-        gFrontierTempParty[i] = monId;
-        i++;
+    // The opponent's species and held items don't repeat
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        gFrontierTempParty[i] = DrawFrontierMonFromPool(pool);
+        if (gFrontierTempParty[i] == 0xFFFF)
+            gFrontierTempParty[i] = GetFactoryOpponentMonId(lvlMode, challengeNum);
     }
+    DestroyFrontierMonPool(pool);
 }
 
 static void SetOpponentGfxVar(void)
@@ -752,8 +734,8 @@ u8 GetFactoryMonFixedIV(u8 challengeNum, bool8 isLastBattle)
 void FillFactoryBrainParty(void)
 {
     int i, j, k;
-    u16 species[FRONTIER_PARTY_SIZE];
-    u16 heldItems[FRONTIER_PARTY_SIZE];
+    u16 monId, firstMonId, lastMonId;
+    struct FrontierMonPool *pool;
     u8 friendship;
     int monLevel;
     u8 fixedIV;
@@ -764,13 +746,12 @@ void FillFactoryBrainParty(void)
     u8 challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / 7;
     fixedIV = GetFactoryMonFixedIV(challengeNum + 2, FALSE);
     monLevel = SetFacilityPtrsGetLevel();
-    i = 0;
     otId = T1_READ_32(gSaveBlock2Ptr->playerTrainerId);
 
-    while (i != FRONTIER_PARTY_SIZE)
+    pool = CreateFrontierMonPool();
+    GetFactoryMonIdRange(lvlMode, challengeNum, FALSE, &firstMonId, &lastMonId);
+    for (monId = firstMonId; monId <= lastMonId; monId++)
     {
-        u16 monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
-
         if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
             continue;
         if (monLevel == FRONTIER_MAX_LEVEL_50 && monId > FRONTIER_MONS_HIGH_TIER)
@@ -784,24 +765,15 @@ void FillFactoryBrainParty(void)
         if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
             continue;
 
-        for (k = 0; k < i; k++)
-        {
-            if (species[k] == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (k != i)
-            continue;
+        AddFrontierMonPoolCandidate(pool, monId);
+    }
 
-        for (k = 0; k < i; k++)
-        {
-            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (k != i)
-            continue;
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        monId = DrawFrontierMonFromPool(pool);
+        if (monId == 0xFFFF)
+            monId = GetFactoryOpponentMonId(lvlMode, challengeNum);
 
-        species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i],
                                              gFacilityTrainerMons[monId].species,
                                              monLevel,
@@ -815,13 +787,36 @@ void FillFactoryBrainParty(void)
             SetMonMoveAvoidReturn(&gEnemyParty[i], gFacilityTrainerMons[monId].moves[k], k);
         SetMonData(&gEnemyParty[i], MON_DATA_FRIENDSHIP, &friendship);
         SetMonData(&gEnemyParty[i], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
-        i++;
     }
+    DestroyFrontierMonPool(pool);
 }
 
 static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
 {
-    u16 numMons, monId;
+    u16 firstMonId, lastMonId;
+
+    GetFactoryMonIdRange(lvlMode, challengeNum, useBetterRange, &firstMonId, &lastMonId);
+    return firstMonId + Random() % (lastMonId - firstMonId + 1);
+}
+
+// Any mon an opponent's pool could have held, without checking it against the
+// rest of the party. Used when the pool has nothing left to draw.
+static u16 GetFactoryOpponentMonId(u8 lvlMode, u8 challengeNum)
+{
+    u16 monId;
+
+    do
+    {
+        monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
+    } while (gFacilityTrainerMons[monId].species == SPECIES_UNOWN
+          || (lvlMode == FRONTIER_LVL_50 && monId > FRONTIER_MONS_HIGH_TIER));
+
+    return monId;
+}
+
+static void GetFactoryMonIdRange(u8 lvlMode, u8 challengeNum, bool8 useBetterRange, u16 *firstMonId, u16 *lastMonId)
+{
+    u16 range;
     u16 adder; // Used to skip past early mons for open level
 
     if (lvlMode == FRONTIER_LVL_50)
@@ -832,30 +827,17 @@ static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
     if (challengeNum < 7)
     {
         if (useBetterRange)
-        {
-            numMons = (sInitialRentalMonRanges[adder + challengeNum + 1][1] - sInitialRentalMonRanges[adder + challengeNum + 1][0]) + 1;
-            monId = Random() % numMons;
-            monId += sInitialRentalMonRanges[adder + challengeNum + 1][0];
-        }
+            range = adder + challengeNum + 1;
         else
-        {
-            numMons = (sInitialRentalMonRanges[adder + challengeNum][1] - sInitialRentalMonRanges[adder + challengeNum][0]) + 1;
-            monId = Random() % numMons;
-            monId += sInitialRentalMonRanges[adder + challengeNum][0];
-        }
+            range = adder + challengeNum;
     }
     else
     {
-        u16 challenge = challengeNum;
-        if (challenge != 7)
-            challenge = 7; // why bother assigning it above at all
-
-        numMons = (sInitialRentalMonRanges[adder + challenge][1] - sInitialRentalMonRanges[adder + challenge][0]) + 1;
-        monId = Random() % numMons;
-        monId += sInitialRentalMonRanges[adder + challenge][0];
+        range = adder + 7;
     }
 
-    return monId;
+    *firstMonId = sInitialRentalMonRanges[range][0];
+    *lastMonId = sInitialRentalMonRanges[range][1];
 }
 
 u8 GetNumPastRentalsRank(u8 battleMode, u8 lvlMode)
@@ -836,6 +836,85 @@ void (* const gBattleScriptingCommandsTable[])(void) =
     Cmd_callnative,                              //0xFF
 };
 
+// Commands that only read and write battle state. They never wait on a
+// controller, print, animate or play sounds, so RunBattleScriptCommandsInFrame
+// can go straight on to the next command. Everything else is blocking.
+static const bool8 sBattleScriptCommandIsPure[0x100] =
+{
+    [0x1] = TRUE,                                // accuracycheck
+    [0x4] = TRUE,                                // critcalc
+    [0x5] = TRUE,                                // damagecalc
+    [0x6] = TRUE,                                // typecalc
+    [0x7] = TRUE,                                // adjustdamage
+    [0x15] = TRUE,                               // seteffectwithchance
+    [0x16] = TRUE,                               // seteffectprimary
+    [0x17] = TRUE,                               // seteffectsecondary
+    [0x1C] = TRUE,                               // jumpifstatus
+    [0x1D] = TRUE,                               // jumpifstatus2
+    [0x1E] = TRUE,                               // jumpifability
+    [0x1F] = TRUE,                               // jumpifsideaffecting
+    [0x20] = TRUE,                               // jumpifstat
+    [0x21] = TRUE,                               // jumpifstatus3condition
+    [0x22] = TRUE,                               // jumpbasedontype
+    [0x25] = TRUE,                               // movevaluescleanup
+    [0x26] = TRUE,                               // setmultihit
+    [0x27] = TRUE,                               // decrementmultihit
+    [0x28] = TRUE,                               // goto
+    [0x29] = TRUE,                               // jumpifbyte
+    [0x2A] = TRUE,                               // jumpifhalfword
+    [0x2B] = TRUE,                               // jumpifword
+    [0x2C] = TRUE,                               // jumpifarrayequal
+    [0x2D] = TRUE,                               // jumpifarraynotequal
+    [0x2E] = TRUE,                               // setbyte
+    [0x2F] = TRUE,                               // addbyte
+    [0x30] = TRUE,                               // subbyte
+    [0x31] = TRUE,                               // copyarray
+    [0x32] = TRUE,                               // copyarraywithindex
+    [0x33] = TRUE,                               // orbyte
+    [0x34] = TRUE,                               // orhalfword
+    [0x35] = TRUE,                               // orword
+    [0x36] = TRUE,                               // bicbyte
+    [0x37] = TRUE,                               // bichalfword
+    [0x38] = TRUE,                               // bicword
+    [0x3C] = TRUE,                               // return
+    [0x40] = TRUE,                               // jumpifaffectedbyprotect
+    [0x41] = TRUE,                               // call
+    [0x43] = TRUE,                               // jumpifabilitypresent
+    [0x47] = TRUE,                               // setgraphicalstatchangevalues
+    [0x5F] = TRUE,                               // swapattackerwithtarget
+    [0x63] = TRUE,                               // jumptocalledmove
+    [0x6B] = TRUE,                               // atknameinbuff1
+    [0x70] = TRUE,                               // recordability
+    [0x71] = TRUE,                               // buffermovetolearn
+    [0x73] = TRUE,                               // hpthresholds
+    [0x74] = TRUE,                               // hpthresholds2
+    [0x7A] = TRUE,                               // jumpifnexttargetvalid
+    [0x80] = TRUE,                               // manipulatedamage
+    [0x82] = TRUE,                               // jumpifnotfirstturn
+    [0x86] = TRUE,                               // stockpiletobasedamage
+    [0x88] = TRUE,                               // setdrainedhp
+    [0x89] = TRUE,                               // statbuffchange
+    [0x8E] = TRUE,                               // initmultihitstring
+    [0x94] = TRUE,                               // damagetohalftargethp
+    [0x9F] = TRUE,                               // dmgtolevel
+    [0xA1] = TRUE,                               // counterdamagecalculator
+    [0xA2] = TRUE,                               // mirrorcoatdamagecalculator
+    [0xA5] = TRUE,                               // painsplitdmgcalc
+    [0xA7] = TRUE,                               // setalwayshitflag
+    [0xB4] = TRUE,                               // jumpifconfusedandstatmaxed
+    [0xBF] = TRUE,                               // setdefensecurlbit
+    [0xC2] = TRUE,                               // selectfirstvalidtarget
+    [0xC5] = TRUE,                               // setsemiinvulnerablebit
+    [0xC6] = TRUE,                               // clearsemiinvulnerablebit
+    [0xCF] = TRUE,                               // jumpifnodamage
+    [0xD8] = TRUE,                               // setdamagetohealthdifference
+    [0xE3] = TRUE,                               // jumpifhasnohp
+    [0xE8] = TRUE,                               // settypebasedhalvers
+    [0xE9] = TRUE,                               // jumpifsubstituteblocks
+    [0xF4] = TRUE,                               // subattackerhpbydmg
+    [0xFC] = TRUE,                               // jumpifoppositegenders
+};
+
 const struct StatFractions gAccuracyStageRatios[] =
 {
     { 33, 100}, // -6
@@ -1356,6 +1435,31 @@ static const u8 sBattlePalaceNatureToFlavorTextId[NUM_NATURES] =
     [NATURE_QUIRKY]  = B_MSG_EAGER_FOR_MORE,
 };
 
+// Runs the current command and keeps going for as long as the commands are
+// pure, so long stretches of script logic don't cost a frame per opcode.
+// Stops as soon as a command hands work to the controllers, switches the main
+// function, doesn't advance the script or B_SCRIPT_CMDS_PER_FRAME commands
+// have run. The limit is a command count, not a cycle budget.
+void RunBattleScriptCommandsInFrame(void)
+{
+    u32 i;
+
+    for (i = 0; i < B_SCRIPT_CMDS_PER_FRAME; i++)
+    {
+        const u8 *instr = gBattlescriptCurrInstr;
+        void (*mainFunc)(void) = gBattleMainFunc;
+        bool32 isPure = sBattleScriptCommandIsPure[*instr];
+
+        gBattleScriptingCommandsTable[*instr]();
+
+        if (!isPure
+         || gBattleControllerExecFlags != 0
+         || gBattleMainFunc != mainFunc
+         || gBattlescriptCurrInstr == instr)
+            break;
+    }
+}
+
 static bool32 NoTargetPresent(u8 battlerId, u32 move)
 {
     if (!IsBattlerAlive(gBattlerTarget))
@@ -1826,7 +1930,7 @@ u32 GetTotalAccuracy(u32 battlerAtk, u32 battlerDef, u32 move, u32 atkAbility, u
 #if B_AFFECTION_MECHANICS == TRUE
     // With high affection/friendship there's a chance to evade a move by substracting 10% of its accuracy.
     // I can't find exact information about that chance, so I'm just gonna write it as a 20% chance for now.
-    if (GetBattlerFriendshipScore(battlerDef) >= FRIENDSHIP_150_TO_199 && (Random() % 100) <= 20)
+    if (GetBattlerFriendshipScore(battlerDef) >= FRIENDSHIP_150_TO_199 && RandomUniform(100) <= 20)
         calc = (calc * 90) / 100;
 #endif
 
@@ -1866,7 +1970,7 @@ static void Cmd_accuracycheck(void)
             return;
 
         // final calculation
-        if ((Random() % 100 + 1) > GetTotalAccuracy(gBattlerAttacker, gBattlerTarget, move, GetBattlerAbility(gBattlerAttacker), GetBattlerAbility(gBattlerTarget),
+        if ((RandomUniform(100) + 1) > GetTotalAccuracy(gBattlerAttacker, gBattlerTarget, move, GetBattlerAbility(gBattlerAttacker), GetBattlerAbility(gBattlerTarget),
                                                     GetBattlerHoldEffect(gBattlerAttacker, TRUE), GetBattlerHoldEffect(gBattlerTarget, TRUE)))
         {
             gMoveResultFlags |= MOVE_RESULT_MISSED;
@@ -2040,7 +2144,7 @@ static void Cmd_critcalc(void)
         gIsCriticalHit = FALSE;
     else if (critChance == -2)
         gIsCriticalHit = TRUE;
-    else if (Random() % sCriticalHitChance[critChance] == 0)
+    else if (RandomUniform(sCriticalHitChance[critChance]) == 0)
         gIsCriticalHit = TRUE;
     else
         gIsCriticalHit = FALSE;
@@ -2078,7 +2182,7 @@ static void Cmd_adjustdamage(void)
     u8 holdEffect, param;
     u32 moveType;
     u32 friendshipScore = GetBattlerFriendshipScore(gBattlerTarget);
-    u32 rand = Random() % 100;
+    u32 rand = RandomUniform(100);
 
     GET_MOVE_TYPE(gCurrentMove, moveType);
 
@@ -3056,9 +3160,9 @@ void SetMoveEffect(bool32 primary, u32 certain)
 
             if (sStatusFlagsForMoveEffects[gBattleScripting.moveEffect] == STATUS1_SLEEP)
             #if B_SLEEP_TURNS >= GEN_5
-                gBattleMons[gEffectBattler].status1 |= ((Random() % 3) + 2);
+                gBattleMons[gEffectBattler].status1 |= (RandomUniform(3) + 2);
             #else
-                gBattleMons[gEffectBattler].status1 |= ((Random() % 4) + 3);
+                gBattleMons[gEffectBattler].status1 |= (RandomUniform(4) + 3);
             #endif
             else
                 gBattleMons[gEffectBattler].status1 |= sStatusFlagsForMoveEffects[gBattleScripting.moveEffect];
@@ -3207,7 +3311,7 @@ void SetMoveEffect(bool32 primary, u32 certain)
                 }
                 else
                 {
-                    gBattleScripting.moveEffect = Random() % 3 + 3;
+                    gBattleScripting.moveEffect = RandomUniform(3) + 3;
                     SetMoveEffect(FALSE, 0);
                 }
                 break;
@@ -3229,11 +3333,11 @@ void SetMoveEffect(bool32 primary, u32 certain)
                 #if B_BINDING_TURNS >= GEN_5
                         gDisableStructs[gEffectBattler].wrapTurns = 7;
                     else
-                        gDisableStructs[gEffectBattler].wrapTurns = (Random() % 2) + 4;
+                        gDisableStructs[gEffectBattler].wrapTurns = RandomUniform(2) + 4;
                 #else
                         gDisableStructs[gEffectBattler].wrapTurns = 5;
                     else
-                        gDisableStructs[gEffectBattler].wrapTurns = (Random() % 4) + 2;
+                        gDisableStructs[gEffectBattler].wrapTurns = RandomUniform(4) + 2;
                 #endif
 
                     gBattleStruct->wrappedMove[gEffectBattler] = gCurrentMove;
@@ -3682,7 +3786,7 @@ static void Cmd_seteffectwithchance(void)
         gBattleScripting.moveEffect &= ~MOVE_EFFECT_CERTAIN;
         SetMoveEffect(FALSE, MOVE_EFFECT_CERTAIN);
     }
-    else if (Random() % 100 < percentChance
+    else if (RandomUniform(100) < percentChance
              && gBattleScripting.moveEffect
              && !(gMoveResultFlags & MOVE_RESULT_NO_EFFECT))
     {
@@ -8504,7 +8608,7 @@ static void Cmd_various(void)
             u32 statId;
             do
             {
-                statId = (Random() % (NUM_BATTLE_STATS - 1)) + 1;
+                statId = RandomUniform(NUM_BATTLE_STATS - 1) + 1;
             } while (!(bits & gBitTable[statId]));
 
             SET_STATCHANGER(statId, 2, FALSE);
@@ -9919,7 +10023,7 @@ static void Cmd_various(void)
 
         special = ((((2 * gBattleMons[gBattlerAttacker].level / 5 + 2) * gBattleMoves[gCurrentMove].power * attackerSpAtkStat) / targetSpDefStat) / 50);
 
-        if (((physical > special) || (physical == special && (Random() % 2) == 0)))
+        if (((physical > special) || (physical == special && RandomUniform(2) == 0)))
             gBattleStruct->swapDamageCategory = TRUE;
         break;
     }
@@ -10469,7 +10573,7 @@ static void Cmd_trymirrormove(void)
     else if (validMovesCount != 0)
     {
         gHitMarker &= ~HITMARKER_ATTACKSTRING_PRINTED;
-        i = Random() % validMovesCount;
+        i = RandomUniform(validMovesCount);
         gCurrentMove = validMoves[i];
         gBattlerTarget = GetMoveTarget(gCurrentMove, NO_TARGET_OVERRIDE);
         gBattlescriptCurrInstr = gBattleScriptsForMoveEffects[gBattleMoves[gCurrentMove].effect];
@@ -11197,7 +11301,7 @@ static void Cmd_setmultihitcounter(void)
             // 35% for 3 hits
             // 15% for 4 hits
             // 15% for 5 hits
-            gMultiHitCounter = Random() % 100;
+            gMultiHitCounter = RandomUniform(100);
             if (gMultiHitCounter < 35)
                 gMultiHitCounter = 2;
             else if (gMultiHitCounter < 35 + 35)
@@ -11209,9 +11313,9 @@ static void Cmd_setmultihitcounter(void)
         #else
             // 2 and 3 hits: 37.5%
             // 4 and 5 hits: 12.5%
-            gMultiHitCounter = Random() % 4;
+            gMultiHitCounter = RandomUniform(4);
             if (gMultiHitCounter > 1)
-                gMultiHitCounter = (Random() % 4) + 2;
+                gMultiHitCounter = RandomUniform(4) + 2;
             else
                 gMultiHitCounter += 2;
         #endif
@@ -11404,7 +11508,7 @@ static void Cmd_forcerandomswitch(void)
 
             do
             {
-                i = Random() % monsCount;
+                i = RandomUniform(monsCount);
                 i += firstMonId;
             }
             while (i == battler2PartyId
@@ -11577,7 +11681,7 @@ static void Cmd_tryKO(void)
 
     gPotentialItemEffectBattler = gBattlerTarget;
     if (holdEffect == HOLD_EFFECT_FOCUS_BAND
-        && (Random() % 100) < GetBattlerHoldEffectParam(gBattlerTarget))
+        && RandomUniform(100) < GetBattlerHoldEffectParam(gBattlerTarget))
     {
         gSpecialStatuses[gBattlerTarget].focusBanded = TRUE;
         RecordItemEffectBattle(gBattlerTarget, holdEffect);
@@ -11612,7 +11716,7 @@ static void Cmd_tryKO(void)
             if (gCurrentMove == MOVE_SHEER_COLD && !IS_BATTLER_OF_TYPE(gBattlerAttacker, TYPE_ICE))
                 odds -= 10;
         #endif
-            if (Random() % 100 + 1 < odds && gBattleMons[gBattlerAttacker].level >= gBattleMons[gBattlerTarget].level)
+            if (RandomUniform(100) + 1 < odds && gBattleMons[gBattlerAttacker].level >= gBattleMons[gBattlerTarget].level)
                 lands = TRUE;
         }
 
@@ -11976,7 +12080,7 @@ static void Cmd_metronome(void)
 
     while (TRUE)
     {
-        gCurrentMove = (Random() % (moveCount - 1)) + 1;
+        gCurrentMove = RandomUniform(moveCount - 1) + 1;
         if (gBattleMoves[gCurrentMove].effect == EFFECT_PLACEHOLDER)
             continue;
 
@@ -12000,9 +12104,9 @@ static void Cmd_psywavedamageeffect(void)
 {
     s32 randDamage;
 #if B_PSYWAVE_DMG >= GEN_6
-    randDamage = (Random() % 101);
+    randDamage = RandomUniform(101);
 #else
-    randDamage = (Random() % 11) * 10;
+    randDamage = RandomUniform(11) * 10;
 #endif
     gBattleMoveDamage = gBattleMons[gBattlerAttacker].level * (randDamage + 50) / 100;
     gBattlescriptCurrInstr++;
@@ -12180,7 +12284,7 @@ static void Cmd_settypetorandomresistance(void)
 
         while (resistTypes != 0)
         {
-            i = Random() % NUMBER_OF_MON_TYPES;
+            i = RandomUniform(NUMBER_OF_MON_TYPES);
             if (resistTypes & gBitTable[i])
             {
                 if (IS_BATTLER_OF_TYPE(gBattlerAttacker, i))
@@ -12737,7 +12841,7 @@ static void Cmd_setsafeguard(void)
 
 static void Cmd_magnitudedamagecalculation(void)
 {
-    u32 magnitude = Random() % 100;
+    u32 magnitude = RandomUniform(100);
 
     if (magnitude < 5)
     {
@@ -13925,7 +14029,7 @@ static void Cmd_pickup(void)
                 && species != SPECIES_NONE
                 && species != SPECIES_EGG
                 && heldItem == ITEM_NONE
-                && (Random() % 10) == 0)
+                && RandomUniform(10) == 0)
             {
                 heldItem = GetBattlePyramidPickupItemId();
                 SetMonData(&gPlayerParty[i], MON_DATA_HELD_ITEM, &heldItem);
@@ -13936,7 +14040,7 @@ static void Cmd_pickup(void)
                 && species != SPECIES_EGG
                 && heldItem == ITEM_NONE)
             {
-                if ((lvlDivBy10 + 1 ) * 5 > Random() % 100)
+                if ((lvlDivBy10 + 1 ) * 5 > RandomUniform(100))
                 {
                     heldItem = ITEM_HONEY;
                     SetMonData(&gPlayerParty[i], MON_DATA_HELD_ITEM, &heldItem);
@@ -13961,10 +14065,10 @@ static void Cmd_pickup(void)
                 && species != SPECIES_NONE
                 && species != SPECIES_EGG
                 && heldItem == ITEM_NONE
-                && (Random() % 10) == 0)
+                && RandomUniform(10) == 0)
             {
                 s32 j;
-                s32 rand = Random() % 100;
+                s32 rand = RandomUniform(100);
 
                 for (j = 0; j < (int)ARRAY_COUNT(sPickupProbabilities); j++)
                 {
@@ -13986,7 +14090,7 @@ static void Cmd_pickup(void)
                 && species != SPECIES_EGG
                 && heldItem == ITEM_NONE)
             {
-                if ((lvlDivBy10 + 1 ) * 5 > Random() % 100)
+                if ((lvlDivBy10 + 1 ) * 5 > RandomUniform(100))
                 {
                     heldItem = ITEM_HONEY;
                     SetMonData(&gPlayerParty[i], MON_DATA_HELD_ITEM, &heldItem);
@@ -15035,7 +15139,7 @@ static bool32 CriticalCapture(u32 odds)
     #endif
 
     odds /= 6;
-    if ((Random() % 255) < odds)
+    if (RandomUniform(255) < odds)
         return TRUE;
 
     return FALSE;
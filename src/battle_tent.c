@@ -56,8 +56,6 @@ static void GenerateInitialRentalMons(void);
  *
  */
 
-static u16 sRandMonId;
-
 void static (*const sVerdanturfTentFuncs[])(void) =
 {
     [VERDANTURF_TENT_FUNC_INIT]               = InitVerdanturfTentChallenge,
@@ -351,11 +349,10 @@ static void GenerateInitialRentalMons(void)
 static void GenerateOpponentMons(void)
 {
     u16 trainerId;
-    s32 i, j, k;
+    s32 i;
     const u16 *monSet;
-    u16 species[FRONTIER_PARTY_SIZE];
-    u16 heldItems[FRONTIER_PARTY_SIZE];
     s32 numMons = 0;
+    struct FrontierMonPool *pool;
 
     gFacilityTrainers = gSlateportBattleTentTrainers;
     gFacilityTrainerMons = gSlateportBattleTentMons;
@@ -386,42 +383,19 @@ static void GenerateOpponentMons(void)
         gSaveBlock2Ptr->frontier.trainerIds[gSaveBlock2Ptr->frontier.curChallengeBattleNum] = gTrainerBattleOpponent_A;
 
     monSet = gFacilityTrainers[gTrainerBattleOpponent_A].monSet;
-    i = 0;
-    while (i != FRONTIER_PARTY_SIZE)
-    {
-        sRandMonId = monSet[Random() % numMons];
+    pool = CreateFrontierMonPool();
+    AddFrontierMonSetToPool(pool, monSet, FALSE);
 
-        // Ensure none of the opponent's pokemon are the same as the potential rental pokemon for the player
-        for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
-        {
-            if (gFacilityTrainerMons[sRandMonId].species == gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[j].monId].species)
-                break;
-        }
-        if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
-            continue;
+    // Ensure none of the opponent's pokemon are the same as the potential rental pokemon for the player
+    for (i = 0; i < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); i++)
+        MarkFrontierMonPoolUsed(pool, gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[i].monId].species, ITEM_NONE);
 
-        // Ensure this species hasn't already been chosen for the opponent
-        for (k = 0; k < i; k++)
-        {
-            if (species[k] == gFacilityTrainerMons[sRandMonId].species)
-                break;
-        }
-        if (k != i)
-            continue;
-
-        // Ensure held items don't repeat on the opponent's team
-        for (k = 0; k < i; k++)
-        {
-            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[sRandMonId].itemTableId])
-                break;
-        }
-        if (k != i)
-            continue;
-
-        // Successful selection
-        species[i] = gFacilityTrainerMons[sRandMonId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[sRandMonId].itemTableId];
-        gFrontierTempParty[i] = sRandMonId;
-        i++;
+    // The opponent's species and held items don't repeat
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        gFrontierTempParty[i] = DrawFrontierMonFromPool(pool);
+        if (gFrontierTempParty[i] == 0xFFFF)
+            gFrontierTempParty[i] = GetRandomFrontierMonFromMonSet(monSet, FALSE);
     }
+    DestroyFrontierMonPool(pool);
 }
@@ -5,6 +5,7 @@
 #include "battle_setup.h"
 #include "overworld.h"
 #include "random.h"
+#include "malloc.h"
 #include "text.h"
 #include "main.h"
 #include "international_string_util.h"
@@ -1039,7 +1040,7 @@ static bool8 ChooseSpecialBattleTowerTrainer(void)
 
     if (idsCount != 0)
     {
-        gTrainerBattleOpponent_A = trainerIds[Random() % idsCount];
+        gTrainerBattleOpponent_A = trainerIds[RandomUniform(idsCount)];
         return TRUE;
     }
     else
@@ -1111,19 +1112,19 @@ u16 GetRandomScaledFrontierTrainerId(u8 challengeNum, u8 battleNum)
         {
             // The last battle in each challenge has a jump in difficulty, pulls from a table with higher ranges
             trainerId = (sFrontierTrainerIdRangesHard[challengeNum][1] - sFrontierTrainerIdRangesHard[challengeNum][0]) + 1;
-            trainerId = sFrontierTrainerIdRangesHard[challengeNum][0] + (Random() % trainerId);
+            trainerId = sFrontierTrainerIdRangesHard[challengeNum][0] + RandomUniform(trainerId);
         }
         else
         {
             trainerId = (sFrontierTrainerIdRanges[challengeNum][1] - sFrontierTrainerIdRanges[challengeNum][0]) + 1;
-            trainerId = sFrontierTrainerIdRanges[challengeNum][0] + (Random() % trainerId);
+            trainerId = sFrontierTrainerIdRanges[challengeNum][0] + RandomUniform(trainerId);
         }
     }
     else
     {
         // After challenge 7, trainer IDs always come from the last, hardest range, which is the same for both trainer ID tables
         trainerId = (sFrontierTrainerIdRanges[7][1] - sFrontierTrainerIdRanges[7][0]) + 1;
-        trainerId = sFrontierTrainerIdRanges[7][0] + (Random() % trainerId);
+        trainerId = sFrontierTrainerIdRanges[7][0] + RandomUniform(trainerId);
     }
 
     return trainerId;
@@ -1398,7 +1399,7 @@ void PutNewBattleTowerRecord(struct EmeraldBattleTowerRecord *newRecordEm)
         }
     }
 
-    i = Random() % slotsCount;
+    i = RandomUniform(slotsCount);
     gSaveBlock2Ptr->frontier.towerRecords[slotIds[i]] = *newRecord;
 }
 
@@ -1643,13 +1644,12 @@ static void FillTentTrainerParty(u8 monsCount)
 static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
-    u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
     u8 friendship = MAX_FRIENDSHIP;
     u8 level = SetFacilityPtrsGetLevel();
     u8 fixedIV = 0;
-    u8 bfMonCount;
     const u16 *monSet = NULL;
     u32 otID = 0;
+    struct FrontierMonPool *pool;
 
     if (trainerId < FRONTIER_TRAINERS_COUNT)
     {
@@ -1690,52 +1690,28 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
     }
 
     // Regular battle frontier trainer.
-    // Attempt to fill the trainer's party with random Pokemon until 3 have been
-    // successfully chosen. The trainer's party may not have duplicate pokemon species
-    // or duplicate held items.
-    for (bfMonCount = 0; monSet[bfMonCount] != 0xFFFF; bfMonCount++)
-        ;
-    i = 0;
-    otID = Random32();
-    while (i != monCount)
+    // Fill the trainer's party with random Pokemon from its set. The trainer's party
+    // may not have duplicate pokemon species or duplicate held items, including with
+    // any partner Pokemon already placed before firstMonId.
+    pool = CreateFrontierMonPool();
+    // "High tier" pokemon are only allowed on open level mode
+    // 20 is not a possible value for level here
+    AddFrontierMonSetToPool(pool, monSet, level == FRONTIER_MAX_LEVEL_50 || level == 20);
+    for (j = 0; j < firstMonId; j++)
     {
-        u16 monId = monSet[Random() % bfMonCount];
-
-        // "High tier" pokemon are only allowed on open level mode
-        // 20 is not a possible value for level here
-        if ((level == FRONTIER_MAX_LEVEL_50 || level == 20) && monId > FRONTIER_MONS_HIGH_TIER)
-            continue;
-
-        // Ensure this pokemon species isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL) == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this Pokemon's held item isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) != ITEM_NONE
-             && GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
+        MarkFrontierMonPoolUsed(pool,
+                                GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL),
+                                GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL));
+    }
 
-        // Ensure this exact pokemon index isn't a duplicate. This check doesn't seem necessary
-        // because the species and held items were already checked directly above.
-        for (j = 0; j < i; j++)
-        {
-            if (chosenMonIndices[j] == monId)
-                break;
-        }
-        if (j != i)
-            continue;
+    otID = Random32();
+    for (i = 0; i < monCount; i++)
+    {
+        u16 monId = DrawFrontierMonFromPool(pool);
 
-        chosenMonIndices[i] = monId;
+        // Nothing left that doesn't clash with the party
+        if (monId == 0xFFFF)
+            monId = GetRandomFrontierMonFromMonSet(monSet, level == FRONTIER_MAX_LEVEL_50 || level == 20);
 
         // Place the chosen pokemon into the trainer's party.
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
@@ -1757,11 +1733,8 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
 
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_FRIENDSHIP, &friendship);
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
-
-        // The pokemon was successfully added to the trainer's party, so it's safe to move on to
-        // the next party slot.
-        i++;
     }
+    DestroyFrontierMonPool(pool);
 }
 
 // Probably an early draft before the 'CreateApprenticeMon' was written.
@@ -1800,28 +1773,129 @@ static void Unused_CreateApprenticeMons(u16 trainerId, u8 firstMonId)
 u16 GetRandomFrontierMonFromSet(u16 trainerId)
 {
     u8 level = SetFacilityPtrsGetLevel();
-    const u16 *monSet = gFacilityTrainers[trainerId].monSet;
+
+    // "High tier" pokemon are only allowed on open level mode
+    // 20 is not a possible value for level here
+    return GetRandomFrontierMonFromMonSet(gFacilityTrainers[trainerId].monSet, level == FRONTIER_MAX_LEVEL_50 || level == 20);
+}
+
+// Picks any mon from the set, without checking it against the rest of the
+// party. Used when a FrontierMonPool has nothing left to draw.
+u16 GetRandomFrontierMonFromMonSet(const u16 *monSet, bool32 excludeHighTier)
+{
     u8 numMons = 0;
-    u32 monId = monSet[numMons];
+    u32 monId;
 
-    while (monId != 0xFFFF)
-    {
+    while (monSet[numMons] != 0xFFFF)
         numMons++;
-        monId = monSet[numMons];
-        if (monId == 0xFFFF)
-            break;
-    }
 
     do
     {
-        // "High tier" pokemon are only allowed on open level mode
-        // 20 is not a possible value for level here
-        monId = monSet[Random() % numMons];
-    } while((level == FRONTIER_MAX_LEVEL_50 || level == 20) && monId > FRONTIER_MONS_HIGH_TIER);
+        monId = monSet[RandomUniform(numMons)];
+    } while (excludeHighTier && monId > FRONTIER_MONS_HIGH_TIER);
 
     return monId;
 }
 
+// Candidates for a facility trainer's party. Mons are drawn without
+// replacement, and the species and held items already on the team are kept as
+// bitsets so each candidate is checked once rather than against every mon.
+struct FrontierMonPool
+{
+    u16 count;
+    u16 monIds[NUM_FRONTIER_MONS];
+    u32 usedSpecies[(NUM_SPECIES + 31) / 32];
+    u32 usedItems[(ITEMS_COUNT + 31) / 32];
+    bool8 itemNoneUnique;
+};
+
+// Returns NULL if the heap is full. The pool functions below treat a NULL pool
+// as an empty one, so callers fall back the same way as when it runs dry.
+struct FrontierMonPool *CreateFrontierMonPool(void)
+{
+    return AllocZeroed(sizeof(struct FrontierMonPool));
+}
+
+void DestroyFrontierMonPool(struct FrontierMonPool *pool)
+{
+    Free(pool);
+}
+
+void AddFrontierMonPoolCandidate(struct FrontierMonPool *pool, u16 monId)
+{
+    if (pool != NULL && pool->count < ARRAY_COUNT(pool->monIds))
+        pool->monIds[pool->count++] = monId;
+}
+
+void AddFrontierMonSetToPool(struct FrontierMonPool *pool, const u16 *monSet, bool32 excludeHighTier)
+{
+    u32 i;
+
+    for (i = 0; monSet[i] != 0xFFFF; i++)
+    {
+        // "High tier" pokemon are only allowed on open level mode
+        if (excludeHighTier && monSet[i] > FRONTIER_MONS_HIGH_TIER)
+            continue;
+        AddFrontierMonPoolCandidate(pool, monSet[i]);
+    }
+}
+
+// By default any number of drawn mons may hold no item. The Dome only allows
+// one, as its generators always rejected a repeated item table entry.
+void SetFrontierMonPoolItemNoneUnique(struct FrontierMonPool *pool)
+{
+    if (pool != NULL)
+        pool->itemNoneUnique = TRUE;
+}
+
+// Adds the mons GetRandomFrontierMonFromSet could return for this trainer.
+void AddFrontierTrainerMonsToPool(struct FrontierMonPool *pool, u16 trainerId)
+{
+    u8 level = SetFacilityPtrsGetLevel();
+
+    // 20 is not a possible value for level here
+    AddFrontierMonSetToPool(pool, gFacilityTrainers[trainerId].monSet, level == FRONTIER_MAX_LEVEL_50 || level == 20);
+}
+
+// Keeps later draws from repeating this species or held item.
+void MarkFrontierMonPoolUsed(struct FrontierMonPool *pool, u16 species, u16 heldItem)
+{
+    if (pool == NULL)
+        return;
+    if (species < NUM_SPECIES)
+        pool->usedSpecies[species / 32] |= 1u << (species % 32);
+    if ((heldItem != ITEM_NONE || pool->itemNoneUnique) && heldItem < ITEMS_COUNT)
+        pool->usedItems[heldItem / 32] |= 1u << (heldItem % 32);
+}
+
+// Removes a random candidate and returns its monId, or 0xFFFF once no valid
+// candidate is left. Candidates that clash with an already chosen species or
+// held item are discarded as they come up; they can't become valid again, so
+// this picks uniformly among the valid ones without ever re-rolling.
+u16 DrawFrontierMonFromPool(struct FrontierMonPool *pool)
+{
+    if (pool == NULL)
+        return 0xFFFF;
+
+    while (pool->count != 0)
+    {
+        u32 i = RandomUniform(pool->count);
+        u16 monId = pool->monIds[i];
+        u16 species = gFacilityTrainerMons[monId].species;
+        u16 heldItem = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+
+        pool->monIds[i] = pool->monIds[--pool->count];
+        if (pool->usedSpecies[species / 32] & (1u << (species % 32)))
+            continue;
+        if ((heldItem != ITEM_NONE || pool->itemNoneUnique) && (pool->usedItems[heldItem / 32] & (1u << (heldItem % 32))))
+            continue;
+
+        MarkFrontierMonPoolUsed(pool, species, heldItem);
+        return monId;
+    }
+    return 0xFFFF;
+}
+
 static void FillFactoryTrainerParty(void)
 {
     ZeroEnemyPartyMons();
@@ -2277,10 +2351,10 @@ static void GetApprenticeMultiPartnerParty(u16 trainerId)
         }
     }
 
-    gFrontierTempParty[0] = validSpecies[Random() % count];
+    gFrontierTempParty[0] = validSpecies[RandomUniform(count)];
     do
     {
-        gFrontierTempParty[1] = validSpecies[Random() % count];
+        gFrontierTempParty[1] = validSpecies[RandomUniform(count)];
     } while (gFrontierTempParty[0] == gFrontierTempParty[1]);
 }
 
@@ -2305,10 +2379,10 @@ static void GetRecordMixFriendMultiPartnerParty(u16 trainerId)
         }
     }
 
-    gFrontierTempParty[2] = validSpecies[Random() % count];
+    gFrontierTempParty[2] = validSpecies[RandomUniform(count)];
     do
     {
-        gFrontierTempParty[3] = validSpecies[Random() % count];
+        gFrontierTempParty[3] = validSpecies[RandomUniform(count)];
     } while (gFrontierTempParty[2] == gFrontierTempParty[3]);
 }
 
@@ -2408,7 +2482,7 @@ static void LoadMultiPartnerCandidatesData(void)
     }
     if (r10 != 0)
     {
-        gSaveBlock2Ptr->frontier.trainerIds[6] = spArray[Random() % r10];
+        gSaveBlock2Ptr->frontier.trainerIds[6] = spArray[RandomUniform(r10)];
         objEventTemplates[7].graphicsId = GetBattleFacilityTrainerGfxId(gSaveBlock2Ptr->frontier.trainerIds[6]);
         FlagClear(FLAG_HIDE_BATTLE_TOWER_MULTI_BATTLE_PARTNER_ALT_1);
         GetApprenticeMultiPartnerParty(gSaveBlock2Ptr->frontier.trainerIds[6]);
@@ -2451,7 +2525,7 @@ static void LoadMultiPartnerCandidatesData(void)
     }
     if (r10 != 0)
     {
-        gSaveBlock2Ptr->frontier.trainerIds[7] = spArray[Random() % r10];
+        gSaveBlock2Ptr->frontier.trainerIds[7] = spArray[RandomUniform(r10)];
         objEventTemplates[8].graphicsId = GetBattleFacilityTrainerGfxId(gSaveBlock2Ptr->frontier.trainerIds[7]);
         FlagClear(FLAG_HIDE_BATTLE_TOWER_MULTI_BATTLE_PARTNER_ALT_2);
         GetRecordMixFriendMultiPartnerParty(gSaveBlock2Ptr->frontier.trainerIds[7]);
@@ -3475,11 +3549,11 @@ static u16 GetBattleTentTrainerId(void)
     u32 facility = VarGet(VAR_FRONTIER_FACILITY);
 
     if (facility == FRONTIER_FACILITY_PALACE)       // Verdanturf Tent; uses Palace mechanics
-        return Random() % NUM_BATTLE_TENT_TRAINERS;
+        return RandomUniform(NUM_BATTLE_TENT_TRAINERS);
     else if (facility == FRONTIER_FACILITY_ARENA)   // Fallarbor Tent; uses Arena mechanics
-        return Random() % NUM_BATTLE_TENT_TRAINERS;
+        return RandomUniform(NUM_BATTLE_TENT_TRAINERS);
     else if (facility == FRONTIER_FACILITY_FACTORY) // Slateport Tent; uses Factory mechanics
-        return Random() % NUM_BATTLE_TENT_TRAINERS;
+        return RandomUniform(NUM_BATTLE_TENT_TRAINERS);
     else if (facility == FRONTIER_FACILITY_TOWER)
         return 0;
     else
@@ -3543,63 +3617,33 @@ static void SetNextBattleTentOpponent(void)
 static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
-    u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
     u8 friendship;
     u8 level = SetTentPtrsGetLevel();
     u8 fixedIV = 0;
-    u8 bfMonCount;
     const u16 *monSet = NULL;
     u32 otID = 0;
-    u16 monId;
+    struct FrontierMonPool *pool;
 
     monSet = gFacilityTrainers[gTrainerBattleOpponent_A].monSet;
 
-    bfMonCount = 0;
-    monId = monSet[bfMonCount];
-    while (monId != 0xFFFF)
+    // The trainer's party may not have duplicate pokemon species or duplicate held items.
+    pool = CreateFrontierMonPool();
+    AddFrontierMonSetToPool(pool, monSet, FALSE);
+    for (j = 0; j < firstMonId; j++)
     {
-        bfMonCount++;
-        monId = monSet[bfMonCount];
-        if (monId == 0xFFFF)
-            break;
+        MarkFrontierMonPoolUsed(pool,
+                                GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL),
+                                GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL));
     }
 
-    i = 0;
     otID = Random32();
-    while (i != monCount)
+    for (i = 0; i < monCount; i++)
     {
-        u16 monId = monSet[Random() % bfMonCount];
+        u16 monId = DrawFrontierMonFromPool(pool);
 
-        // Ensure this pokemon species isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL) == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this Pokemon's held item isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) != ITEM_NONE
-             && GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this exact pokemon index isn't a duplicate. This check doesn't seem necessary
-        // because the species and held items were already checked directly above.
-        for (j = 0; j < i; j++)
-        {
-            if (chosenMonIndices[j] == monId)
-                break;
-        }
-        if (j != i)
-            continue;
-
-        chosenMonIndices[i] = monId;
+        // Nothing left that doesn't clash with the party
+        if (monId == 0xFFFF)
+            monId = GetRandomFrontierMonFromMonSet(monSet, FALSE);
 
         // Place the chosen pokemon into the trainer's party.
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
@@ -3621,11 +3665,8 @@ static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
 
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_FRIENDSHIP, &friendship);
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
-
-        // The pokemon was successfully added to the trainer's party, so it's safe to move on to
-        // the next party slot.
-        i++;
     }
+    DestroyFrontierMonPool(pool);
 }
 
 u8 FacilityClassToGraphicsId(u8 facilityClass)
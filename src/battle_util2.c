@@ -69,6 +69,8 @@ void FreeBattleResources(void)
 
         FREE_AND_SET_NULL(gBattleAnimBgTileBuffer);
         FREE_AND_SET_NULL(gBattleAnimBgTilemapBuffer);
+
+        FlushBattleAnimGfxCache();
     }
 }
 
@@ -1165,6 +1165,7 @@ static void FreeContestResources(void)
     FREE_AND_SET_NULL(gContestResources);
     gBattleAnimBgTileBuffer = NULL;
     gBattleAnimBgTilemapBuffer = NULL;
+    FlushBattleAnimGfxCache();
 }
 
 void CB2_StartContest(void)
@@ -16,6 +16,7 @@
 #include "trainer_pokemon_sprites.h"
 #include "starter_choose.h"
 #include "decompress.h"
+#include "fieldmap.h"
 #include "intro_credits_graphics.h"
 #include "sound.h"
 #include "trig.h"
@@ -415,6 +416,7 @@ void CB2_StartCreditsSequence(void)
 
     ResetGpuAndVram();
     SetVBlankCallback(NULL);
+    CancelTilesetPrefetches();
     InitHeap(gHeap, HEAP_SIZE);
     ResetPaletteFade();
     ResetTasks();
@@ -40,6 +40,7 @@ EWRAM_DATA static u16 sHatchedEggEggMoves[EGG_MOVES_ARRAY_COUNT] = {0};
 EWRAM_DATA static u16 sHatchedEggMotherMoves[MAX_MON_MOVES] = {0};
 
 #include "data/pokemon/egg_moves.h"
+#include "data/pokemon/egg_tables.h"
 
 static const struct WindowTemplate sDaycareLevelMenuWindowTemplate =
 {
@@ -388,39 +389,13 @@ static void ClearAllDaycareData(struct DayCare *daycare)
 }
 
 // Determines what the species of an Egg would be based on the given species.
-// It determines this by working backwards through the evolution chain of the
-// given species.
+// sEggSpecies is generated by tools/eggtables, which works backwards through
+// the evolution chain of each species.
 static u16 GetEggSpecies(u16 species)
 {
-    int i, j, k;
-    bool8 found;
-
-    // Working backwards up to 5 times seems arbitrary, since the maximum number
-    // of times would only be 3 for 3-stage evolutions.
-    for (i = 0; i < EVOS_PER_MON; i++)
-    {
-        found = FALSE;
-        for (j = 1; j < NUM_SPECIES; j++)
-        {
-            for (k = 0; k < EVOS_PER_MON; k++)
-            {
-                if (gEvolutionTable[j][k].targetSpecies == species)
-                {
-                    species = j;
-                    found = TRUE;
-                    break;
-                }
-            }
-
-            if (found)
-                break;
-        }
-
-        if (j == NUM_SPECIES)
-            break;
-    }
-
-    return species;
+    if (species >= NUM_SPECIES)
+        return species;
+    return sEggSpecies[species];
 }
 
 static s32 GetParentToInheritNature(struct DayCare *daycare)
@@ -645,26 +620,14 @@ static u8 GetEggMoves(struct Pokemon *pokemon, u16 *eggMoves)
     u16 species;
     u16 i;
 
-    numEggMoves = 0;
-    eggMoveIdx = 0;
     species = GetMonData(pokemon, MON_DATA_SPECIES);
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
-
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
-            break;
+    if (species >= NUM_SPECIES)
+        return 0;
 
+    eggMoveIdx = sEggMoveOffsets[species];
+    numEggMoves = min(sEggMoveCounts[species], EGG_MOVES_ARRAY_COUNT);
+    for (i = 0; i < numEggMoves; i++)
         eggMoves[i] = gEggMoves[eggMoveIdx + i];
-        numEggMoves++;
-    }
 
     return numEggMoves;
 }
@@ -6,7 +6,22 @@
 #include "pokemon_debug.h"
 #include "text.h"
 
+#define LZ77_JOB_COUNT 4
+#define LZ77_BYTES_PER_FRAME 0x1000
+
+// A decompression in progress. Decompressed data is written a byte at a
+// time, so the destination must be in WRAM.
+struct LZ77Job
+{
+    const u8 *src;
+    u8 *dest;
+    u32 remaining;
+    u8 flags;
+    u8 flagsLeft;
+};
+
 EWRAM_DATA ALIGNED(4) u8 gDecompressionBuffer[0x4000] = {0};
+EWRAM_DATA static struct LZ77Job sLZ77Jobs[LZ77_JOB_COUNT] = {0};
 
 void LZDecompressWram(const u32 *src, void *dest)
 {
@@ -18,6 +33,115 @@ void LZDecompressVram(const u32 *src, void *dest)
     LZ77UnCompVram(src, dest);
 }
 
+// Queues src to be decompressed into dest a bit at a time by
+// RunLZ77DecompressionQueue, instead of all at once. Returns the job's id
+// for IsLZ77DecompressionDone, or LZ77_JOB_NONE if the queue is full.
+u8 StartLZ77Decompression(const u32 *src, void *dest)
+{
+    u32 i;
+
+    for (i = 0; i < LZ77_JOB_COUNT; i++)
+    {
+        if (sLZ77Jobs[i].remaining == 0)
+        {
+            sLZ77Jobs[i].src = (const u8 *)src + 4;
+            sLZ77Jobs[i].dest = dest;
+            sLZ77Jobs[i].remaining = GetDecompressedDataSize(src);
+            sLZ77Jobs[i].flagsLeft = 0;
+            return i;
+        }
+    }
+    return LZ77_JOB_NONE;
+}
+
+// Decompresses roughly budget bytes of the job and returns how many were written.
+// Blocks are never split, so this can go over budget by a block's length.
+static u32 RunLZ77Job(struct LZ77Job *job, u32 budget)
+{
+    const u8 *src = job->src;
+    u8 *dest = job->dest;
+    u32 remaining = job->remaining;
+    u32 written = 0;
+    u32 flags = job->flags;
+    u32 flagsLeft = job->flagsLeft;
+
+    while (remaining != 0 && written < budget)
+    {
+        if (flagsLeft == 0)
+        {
+            flags = *src++;
+            flagsLeft = 8;
+        }
+
+        if (flags & 0x80)
+        {
+            u32 length = (src[0] >> 4) + 3;
+            const u8 *block = dest - (((src[0] & 0xF) << 8) | src[1]) - 1;
+
+            src += 2;
+            if (length > remaining)
+                length = remaining;
+            remaining -= length;
+            written += length;
+            while (length--)
+                *dest++ = *block++;
+        }
+        else
+        {
+            *dest++ = *src++;
+            remaining--;
+            written++;
+        }
+
+        flags <<= 1;
+        flagsLeft--;
+    }
+
+    job->src = src;
+    job->dest = dest;
+    job->remaining = remaining;
+    job->flags = flags;
+    job->flagsLeft = flagsLeft;
+    return written;
+}
+
+// Does this frame's share of the queued decompression.
+void RunLZ77DecompressionQueue(void)
+{
+    u32 i;
+    u32 budget = LZ77_BYTES_PER_FRAME;
+
+    for (i = 0; i < LZ77_JOB_COUNT; i++)
+    {
+        u32 written;
+
+        if (sLZ77Jobs[i].remaining == 0)
+            continue;
+
+        written = RunLZ77Job(&sLZ77Jobs[i], budget);
+        if (written >= budget)
+            break;
+        budget -= written;
+    }
+}
+
+bool8 IsLZ77DecompressionDone(u8 jobId)
+{
+    return sLZ77Jobs[jobId].remaining == 0;
+}
+
+// Decompresses whatever is left of the job right away.
+void FinishLZ77Decompression(u8 jobId)
+{
+    if (sLZ77Jobs[jobId].remaining != 0)
+        RunLZ77Job(&sLZ77Jobs[jobId], sLZ77Jobs[jobId].remaining);
+}
+
+void CancelLZ77Decompression(u8 jobId)
+{
+    sLZ77Jobs[jobId].remaining = 0;
+}
+
 u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
 {
     struct SpriteSheet dest;
@@ -272,11 +396,39 @@ u32 GetDecompressedDataSize(const u32 *ptr)
     return (ptr8[3] << 16) | (ptr8[2] << 8) | (ptr8[1]);
 }
 
+bool8 IsLZ77DataVramSafe(const u32 *src)
+{
+    return (*(const u8 *)src & LZ_HEADER_RESERVED_MASK) == 0;
+}
+
+// Decompresses the sheet straight into its tiles, skipping the buffer.
+// Returns FALSE if the data has to go through a buffer instead.
+static bool8 LoadCompressedSpriteSheetToVram(const struct CompressedSpriteSheet *src)
+{
+    struct SpriteSheet dest;
+    u16 tileStart;
+
+    if (!IsLZ77DataVramSafe(src->data) || GetDecompressedDataSize(src->data) != src->size)
+        return FALSE;
+
+    dest.data = NULL;
+    dest.size = src->size;
+    dest.tag = src->tag;
+
+    tileStart = AllocTilesForSpriteSheet(&dest);
+    if (tileStart != 0xFFFF)
+        LZ77UnCompVram(src->data, (void *)(OBJ_VRAM0 + TILE_SIZE_4BPP * tileStart));
+    return TRUE;
+}
+
 bool8 LoadCompressedSpriteSheetUsingHeap(const struct CompressedSpriteSheet *src)
 {
     struct SpriteSheet dest;
     void *buffer;
 
+    if (LoadCompressedSpriteSheetToVram(src))
+        return FALSE;
+
     buffer = AllocZeroed(src->data[0] >> 8);
     LZ77UnCompWram(src->data, buffer);
 
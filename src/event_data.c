@@ -1,6 +1,7 @@
 #include "global.h"
 #include "event_data.h"
 #include "pokedex.h"
+#include "script.h"
 
 #define NUM_SPECIAL_FLAGS (SPECIAL_FLAGS_END - SPECIAL_FLAGS_START + 1)
 #define NUM_TEMP_FLAGS    (TEMP_FLAGS_END - TEMP_FLAGS_START + 1)
@@ -39,12 +40,14 @@ void InitEventData(void)
     memset(gSaveBlock1Ptr->flags, 0, sizeof(gSaveBlock1Ptr->flags));
     memset(gSaveBlock1Ptr->vars, 0, sizeof(gSaveBlock1Ptr->vars));
     memset(sSpecialFlags, 0, sizeof(sSpecialFlags));
+    RequestOnFrameMapScriptCheck();
 }
 
 void ClearTempFieldEventData(void)
 {
     memset(gSaveBlock1Ptr->flags + (TEMP_FLAGS_START / 8), 0, TEMP_FLAGS_SIZE);
     memset(gSaveBlock1Ptr->vars + ((TEMP_VARS_START - VARS_START) * 2), 0, TEMP_VARS_SIZE);
+    RequestOnFrameMapScriptCheck();
     FlagClear(FLAG_SYS_ENC_UP_ITEM);
     FlagClear(FLAG_SYS_ENC_DOWN_ITEM);
     FlagClear(FLAG_SYS_USE_STRENGTH);
@@ -166,7 +169,7 @@ bool32 CanResetRTC(void)
         return FALSE;
 }
 
-u16 *GetVarPointer(u16 id)
+static u16 *GetVarPointerForRead(u16 id)
 {
     if (id < VARS_START)
         return NULL;
@@ -176,9 +179,16 @@ u16 *GetVarPointer(u16 id)
         return gSpecialVars[id - SPECIAL_VARS_START];
 }
 
+// The var may be written to through the returned pointer
+u16 *GetVarPointer(u16 id)
+{
+    SetOnFrameMapScriptVarChanged(id);
+    return GetVarPointerForRead(id);
+}
+
 u16 VarGet(u16 id)
 {
-    u16 *ptr = GetVarPointer(id);
+    u16 *ptr = GetVarPointerForRead(id);
     if (!ptr)
         return id;
     return *ptr;
@@ -186,7 +196,7 @@ u16 VarGet(u16 id)
 
 u16 VarGetIfExist(u16 id)
 {
-    u16 *ptr = GetVarPointer(id);
+    u16 *ptr = GetVarPointerForRead(id);
     if (!ptr)
         return 65535;
     return *ptr;
@@ -194,10 +204,11 @@ u16 VarGetIfExist(u16 id)
 
 bool8 VarSet(u16 id, u16 value)
 {
-    u16 *ptr = GetVarPointer(id);
+    u16 *ptr = GetVarPointerForRead(id);
     if (!ptr)
         return FALSE;
     *ptr = value;
+    SetOnFrameMapScriptVarChanged(id);
     return TRUE;
 }
 
@@ -898,11 +898,51 @@ static bool8 TryDoorWarp(struct MapPosition *position, u16 metatileBehavior, u8
     return FALSE;
 }
 
+// Every event struct starts with its x and y coordinates
+static u32 GetEventPositionKey(const void *events, u32 eventSize, u8 eventId)
+{
+    const u16 *pos = (const u16 *)((const u8 *)events + eventId * eventSize);
+    return ((u32)pos[1] << 16) | pos[0];
+}
+
+// Binary searches a map's events-by-position table (see struct MapEvents) for the first
+// event at the given position. Returns count if there isn't one.
+static s32 FindFirstEventAtPosition(const u8 *byPosition, u8 count, const void *events, u32 eventSize, u16 x, u16 y)
+{
+    u32 key = ((u32)y << 16) | x;
+    s32 low = 0;
+    s32 high = count;
+
+    while (low < high)
+    {
+        s32 mid = (low + high) / 2;
+        if (GetEventPositionKey(events, eventSize, byPosition[mid]) < key)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
 static s8 GetWarpEventAtPosition(struct MapHeader *mapHeader, u16 x, u16 y, u8 elevation)
 {
     s32 i;
     struct WarpEvent *warpEvent = mapHeader->events->warps;
     u8 warpCount = mapHeader->events->warpCount;
+    const u8 *byPosition = mapHeader->events->warpsByPosition;
+
+    if (byPosition != NULL)
+    {
+        for (i = FindFirstEventAtPosition(byPosition, warpCount, warpEvent, sizeof(*warpEvent), x, y); i < warpCount; i++)
+        {
+            warpEvent = &mapHeader->events->warps[byPosition[i]];
+            if ((u16)warpEvent->x != x || (u16)warpEvent->y != y)
+                break;
+            if (warpEvent->elevation == elevation || warpEvent->elevation == 0)
+                return byPosition[i];
+        }
+        return WARP_ID_NONE;
+    }
 
     for (i = 0; i < warpCount; i++, warpEvent++)
     {
@@ -940,6 +980,24 @@ static u8 *GetCoordEventScriptAtPosition(struct MapHeader *mapHeader, u16 x, u16
     s32 i;
     struct CoordEvent *coordEvents = mapHeader->events->coordEvents;
     u8 coordEventCount = mapHeader->events->coordEventCount;
+    const u8 *byPosition = mapHeader->events->coordEventsByPosition;
+
+    if (byPosition != NULL)
+    {
+        for (i = FindFirstEventAtPosition(byPosition, coordEventCount, coordEvents, sizeof(*coordEvents), x, y); i < coordEventCount; i++)
+        {
+            struct CoordEvent *coordEvent = &coordEvents[byPosition[i]];
+            if ((u16)coordEvent->x != x || (u16)coordEvent->y != y)
+                break;
+            if (coordEvent->elevation == elevation || coordEvent->elevation == 0)
+            {
+                u8 *script = TryRunCoordEventScript(coordEvent);
+                if (script != NULL)
+                    return script;
+            }
+        }
+        return NULL;
+    }
 
     for (i = 0; i < coordEventCount; i++)
     {
@@ -966,6 +1024,20 @@ static struct BgEvent *GetBackgroundEventAtPosition(struct MapHeader *mapHeader,
     u8 i;
     struct BgEvent *bgEvents = mapHeader->events->bgEvents;
     u8 bgEventCount = mapHeader->events->bgEventCount;
+    const u8 *byPosition = mapHeader->events->bgEventsByPosition;
+
+    if (byPosition != NULL)
+    {
+        for (i = FindFirstEventAtPosition(byPosition, bgEventCount, bgEvents, sizeof(*bgEvents), x, y); i < bgEventCount; i++)
+        {
+            struct BgEvent *bgEvent = &bgEvents[byPosition[i]];
+            if (bgEvent->x != x || bgEvent->y != y)
+                break;
+            if (bgEvent->elevation == elevation || bgEvent->elevation == 0)
+                return bgEvent;
+        }
+        return NULL;
+    }
 
     for (i = 0; i < bgEventCount; i++)
     {
@@ -922,13 +922,13 @@ static bool8 DestroySnowflakeSprite(void)
 static void InitSnowflakeSpriteMovement(struct Sprite *sprite)
 {
     u16 rand;
-    u16 x = ((sprite->tSnowflakeId * 5) & 7) * 30 + (Random() % 30);
+    u16 x = ((sprite->tSnowflakeId * 5) & 7) * 30 + RandomUniformOverworld(30);
 
     sprite->y = -3 - (gSpriteCoordOffsetY + sprite->centerToCornerVecY);
     sprite->x = x - (gSpriteCoordOffsetX + sprite->centerToCornerVecX);
     sprite->tPosY = sprite->y * 128;
     sprite->x2 = 0;
-    rand = Random();
+    rand = RandomOverworld();
     sprite->tDeltaY = (rand & 3) * 5 + 64;
     sprite->tDeltaY2 = sprite->tDeltaY;
     StartSpriteAnim(sprite, (rand & 1) ? 0 : 1);
@@ -1115,7 +1115,7 @@ void Thunderstorm_Main(void)
         break;
     case THUNDER_STATE_NEW_CYCLE:
         gWeatherPtr->thunderAllowEnd = TRUE;
-        gWeatherPtr->thunderTimer = (Random() % 360) + 360;
+        gWeatherPtr->thunderTimer = RandomUniformOverworld(360) + 360;
         gWeatherPtr->initStep++;
         // fall through
     case THUNDER_STATE_NEW_CYCLE_WAIT:
@@ -1125,11 +1125,11 @@ void Thunderstorm_Main(void)
         break;
     case THUNDER_STATE_INIT_CYCLE_1:
         gWeatherPtr->thunderAllowEnd = TRUE;
-        gWeatherPtr->thunderLongBolt = Random() % 2;
+        gWeatherPtr->thunderLongBolt = RandomUniformOverworld(2);
         gWeatherPtr->initStep++;
         break;
     case THUNDER_STATE_INIT_CYCLE_2:
-        gWeatherPtr->thunderShortBolts = (Random() & 1) + 1;
+        gWeatherPtr->thunderShortBolts = (RandomOverworld() & 1) + 1;
         gWeatherPtr->initStep++;
         // fall through
     case THUNDER_STATE_SHORT_BOLT:
@@ -1139,7 +1139,7 @@ void Thunderstorm_Main(void)
         if (!gWeatherPtr->thunderLongBolt && gWeatherPtr->thunderShortBolts == 1)
             EnqueueThunder(20);
 
-        gWeatherPtr->thunderTimer = (Random() % 3) + 6;
+        gWeatherPtr->thunderTimer = RandomUniformOverworld(3) + 6;
         gWeatherPtr->initStep++;
         break;
     case THUNDER_STATE_TRY_NEW_BOLT:
@@ -1151,7 +1151,7 @@ void Thunderstorm_Main(void)
             if (--gWeatherPtr->thunderShortBolts != 0)
             {
                 // Wait a little, then do another short bolt.
-                gWeatherPtr->thunderTimer = (Random() % 16) + 60;
+                gWeatherPtr->thunderTimer = RandomUniformOverworld(16) + 60;
                 gWeatherPtr->initStep = THUNDER_STATE_WAIT_BOLT_SHORT;
             }
             else if (!gWeatherPtr->thunderLongBolt)
@@ -1171,7 +1171,7 @@ void Thunderstorm_Main(void)
             gWeatherPtr->initStep = THUNDER_STATE_SHORT_BOLT;
         break;
     case THUNDER_STATE_INIT_BOLT_LONG:
-        gWeatherPtr->thunderTimer = (Random() % 16) + 60;
+        gWeatherPtr->thunderTimer = RandomUniformOverworld(16) + 60;
         gWeatherPtr->initStep++;
         break;
     case THUNDER_STATE_WAIT_BOLT_LONG:
@@ -1180,7 +1180,7 @@ void Thunderstorm_Main(void)
             // Do long bolt. Enqueue thunder with a potentially longer delay.
             EnqueueThunder(100);
             ApplyWeatherColorMapIfIdle(19);
-            gWeatherPtr->thunderTimer = (Random() & 0xF) + 30;
+            gWeatherPtr->thunderTimer = (RandomOverworld() & 0xF) + 30;
             gWeatherPtr->initStep++;
         }
         break;
@@ -1243,7 +1243,7 @@ static void EnqueueThunder(u16 waitFrames)
 {
     if (!gWeatherPtr->thunderEnqueued)
     {
-        gWeatherPtr->thunderSETimer = Random() % waitFrames;
+        gWeatherPtr->thunderSETimer = RandomUniformOverworld(waitFrames);
         gWeatherPtr->thunderEnqueued = TRUE;
     }
 }
@@ -1257,7 +1257,7 @@ static void UpdateThunderSound(void)
             if (IsSEPlaying())
                 return;
 
-            if (Random() & 1)
+            if (RandomOverworld() & 1)
                 PlaySE(SE_THUNDER);
             else
                 PlaySE(SE_THUNDER2);
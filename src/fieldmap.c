@@ -1,10 +1,12 @@
 #include "global.h"
 #include "battle_pyramid.h"
 #include "bg.h"
+#include "decompress.h"
 #include "fieldmap.h"
 #include "fldeff.h"
 #include "fldeff_misc.h"
 #include "frontier_util.h"
+#include "malloc.h"
 #include "menu.h"
 #include "mirage_tower.h"
 #include "overworld.h"
@@ -12,6 +14,7 @@
 #include "pokenav.h"
 #include "script.h"
 #include "secret_base.h"
+#include "task.h"
 #include "trainer_hill.h"
 #include "tv.h"
 #include "constants/rgb.h"
@@ -25,11 +28,25 @@ struct ConnectionFlags
     u8 east:1;
 };
 
+// How many metatiles ahead of the camera a map connection starts prefetching its tileset
+#define CONNECTION_PREFETCH_DISTANCE 4
+
+// A compressed tileset decompressed a few KB per frame ahead of when it's
+// needed, while the player walks up to a map connection. Warps aren't
+// prefetched: loading the destination resets the heap the buffer lives in.
+struct TilesetPrefetch
+{
+    struct Tileset const *tileset;
+    void *buffer;
+    u8 jobId;
+};
+
 EWRAM_DATA static u16 sBackupMapData[MAX_MAP_DATA_SIZE] = {0};
 EWRAM_DATA struct MapHeader gMapHeader = {0};
 EWRAM_DATA struct Camera gCamera = {0};
 EWRAM_DATA static struct ConnectionFlags sMapConnectionFlags = {0};
 EWRAM_DATA static u32 sFiller = 0; // without this, the next file won't align properly
+EWRAM_DATA static struct TilesetPrefetch sConnectionTilesetPrefetch = {0};
 
 struct BackupMapLayout gBackupMapLayout;
 
@@ -47,6 +64,8 @@ static bool8 SkipCopyingMetatileFromSavedMap(u16 *mapBlock, u16 mapWidth, u8 yMo
 static struct MapConnection *GetIncomingConnection(u8 direction, int x, int y);
 static bool8 IsPosInIncomingConnectingMap(u8 direction, int x, int y, struct MapConnection *connection);
 static bool8 IsCoordInIncomingConnectingMap(int coord, int srcMax, int destMax, int offset);
+static void PrefetchConnectionTileset(int x, int y);
+static void *TakeTilesetPrefetch(struct Tileset const *tileset);
 
 #define GetBorderBlockAt(x, y)({                                                                   \
     u16 block;                                                                                     \
@@ -655,6 +674,7 @@ bool8 CameraMove(int x, int y)
     {
         gSaveBlock1Ptr->pos.x += x;
         gSaveBlock1Ptr->pos.y += y;
+        PrefetchConnectionTileset(x, y);
     }
     else
     {
@@ -840,26 +860,132 @@ static bool8 SkipCopyingMetatileFromSavedMap(u16 *mapBlock, u16 mapWidth, u8 yMo
 
 static void CopyTilesetToVram(struct Tileset const *tileset, u16 numTiles, u16 offset)
 {
+    void *prefetched;
+
     if (tileset)
     {
         if (!tileset->isCompressed)
+        {
             LoadBgTiles(2, tileset->tiles, numTiles * 32, offset);
+        }
+        else if ((prefetched = TakeTilesetPrefetch(tileset)) != NULL)
+        {
+            if (CopyDecompressedTileDataToVram(2, prefetched, numTiles * 32, offset, 0) == NULL)
+            {
+                Free(prefetched);
+                DecompressAndCopyTileDataToVram(2, tileset->tiles, numTiles * 32, offset, 0);
+            }
+        }
         else
+        {
             DecompressAndCopyTileDataToVram(2, tileset->tiles, numTiles * 32, offset, 0);
+        }
     }
 }
 
 static void CopyTilesetToVramUsingHeap(struct Tileset const *tileset, u16 numTiles, u16 offset)
 {
+    void *prefetched;
+
     if (tileset)
     {
         if (!tileset->isCompressed)
             LoadBgTiles(2, tileset->tiles, numTiles * 32, offset);
+        else if ((prefetched = TakeTilesetPrefetch(tileset)) != NULL)
+            LoadDecompressedBgGfxUsingHeap(2, prefetched, numTiles * 32, offset, 0);
         else
             DecompressAndLoadBgGfxUsingHeap(2, tileset->tiles, numTiles * 32, offset, 0);
     }
 }
 
+static void Task_RunTilesetPrefetch(u8 taskId)
+{
+    RunLZ77DecompressionQueue();
+    if (sConnectionTilesetPrefetch.tileset == NULL || IsLZ77DecompressionDone(sConnectionTilesetPrefetch.jobId))
+        DestroyTask(taskId);
+}
+
+static void CancelTilesetPrefetch(struct TilesetPrefetch *prefetch)
+{
+    if (prefetch->tileset != NULL)
+    {
+        CancelLZ77Decompression(prefetch->jobId);
+        FREE_AND_SET_NULL(prefetch->buffer);
+        prefetch->tileset = NULL;
+    }
+}
+
+static void PrefetchTileset(struct TilesetPrefetch *prefetch, struct Tileset const *tileset)
+{
+    if (prefetch->tileset == tileset)
+        return;
+
+    CancelTilesetPrefetch(prefetch);
+    if (tileset == NULL || !tileset->isCompressed)
+        return;
+
+    prefetch->buffer = Alloc(GetDecompressedDataSize(tileset->tiles));
+    if (prefetch->buffer == NULL)
+        return;
+
+    prefetch->jobId = StartLZ77Decompression(tileset->tiles, prefetch->buffer);
+    if (prefetch->jobId == LZ77_JOB_NONE)
+    {
+        FREE_AND_SET_NULL(prefetch->buffer);
+        return;
+    }
+
+    prefetch->tileset = tileset;
+    if (!FuncIsActiveTask(Task_RunTilesetPrefetch))
+        CreateTask(Task_RunTilesetPrefetch, 80);
+}
+
+// Returns the tileset's tiles if they were prefetched, finishing them off if
+// needed. The caller takes ownership of the buffer.
+static void *TakeTilesetPrefetch(struct Tileset const *tileset)
+{
+    struct TilesetPrefetch *prefetch = &sConnectionTilesetPrefetch;
+    void *buffer;
+
+    if (tileset == NULL || prefetch->tileset != tileset)
+        return NULL;
+
+    buffer = prefetch->buffer;
+    FinishLZ77Decompression(prefetch->jobId);
+    prefetch->buffer = NULL;
+    prefetch->tileset = NULL;
+    return buffer;
+}
+
+// Frees the prefetched tileset. Must be called before anything that resets
+// the heap, e.g. leaving the overworld for a menu or battle, or a warp.
+void CancelTilesetPrefetches(void)
+{
+    CancelTilesetPrefetch(&sConnectionTilesetPrefetch);
+}
+
+// Crossing a map connection reloads the secondary tileset. Start on it while
+// the player is still a few steps away from the connection, and drop it again
+// if they turn back.
+static void PrefetchConnectionTileset(int x, int y)
+{
+    struct Tileset const *tileset = NULL;
+    int direction;
+
+    if (x == 0 && y == 0)
+        return;
+
+    direction = GetPostCameraMoveMapBorderId(x * CONNECTION_PREFETCH_DISTANCE, y * CONNECTION_PREFETCH_DISTANCE);
+    if (direction != CONNECTION_NONE && direction != CONNECTION_INVALID)
+    {
+        struct MapConnection *connection = GetIncomingConnection(direction, gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y);
+
+        if (connection != NULL)
+            tileset = GetMapHeaderFromConnection(connection)->mapLayout->secondaryTileset;
+    }
+    PrefetchTileset(&sConnectionTilesetPrefetch, tileset);
+}
+
 // Below two are dummied functions from FRLG, used to tint the overworld palettes for the Quest Log
 static void ApplyGlobalTintToPaletteEntries(u16 offset, u16 size)
 {
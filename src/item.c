@@ -25,6 +25,8 @@ static bool8 CheckPyramidBagHasItem(u16 itemId, u16 count);
 static bool8 CheckPyramidBagHasSpace(u16 itemId, u16 count);
 static void ShowItemIconSprite(u16 item, bool8 firstTime, bool8 flash);
 static void DestroyItemIconSprite(void);
+static void UpdateBagPocketSlotIndex(u8 pocket);
+static void UpdatePCItemSlotIndex(void);
 
 // EWRAM variables
 EWRAM_DATA struct BagPocket gBagPockets[POCKETS_COUNT] = {0};
@@ -32,6 +34,15 @@ EWRAM_DATA static u8 sHeaderBoxWindowId = 0;
 EWRAM_DATA u8 sItemIconSpriteId = 0;
 EWRAM_DATA u8 sItemIconSpriteId2 = 0;
 
+// Runtime itemId -> slot lookup for the bag and the PC, so that item queries don't have to
+// scan (and decrypt) every slot of a pocket. Each entry holds the first slot containing the
+// item and is only trusted if that slot still holds it, so entries for items that are no
+// longer owned never need clearing.
+EWRAM_DATA static u8 sBagItemSlotIndex[ITEMS_COUNT] = {0};
+EWRAM_DATA static u8 sPCItemSlotIndex[ITEMS_COUNT] = {0};
+EWRAM_DATA static u8 sBagPocketFreeSlots[POCKETS_COUNT] = {0};
+EWRAM_DATA static bool8 sItemSlotIndexValid = FALSE;
+
 // rodata
 #include "data/text/item_descriptions.h"
 #include "data/items.h"
@@ -57,6 +68,94 @@ static void SetPCItemQuantity(u16 *quantity, u16 newValue)
     *quantity = newValue;
 }
 
+static void UpdateBagPocketSlotIndex(u8 pocket)
+{
+    s32 i;
+    u8 freeSlots = 0;
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
+
+    // Walk backwards so that the first slot holding an item wins
+    for (i = bagPocket->capacity - 1; i >= 0; i--)
+    {
+        u16 itemId = bagPocket->itemSlots[i].itemId;
+
+        if (itemId == ITEM_NONE)
+            freeSlots++;
+        else if (itemId < ITEMS_COUNT)
+            sBagItemSlotIndex[itemId] = i;
+    }
+    sBagPocketFreeSlots[pocket] = freeSlots;
+}
+
+static void UpdatePCItemSlotIndex(void)
+{
+    s32 i;
+
+    for (i = PC_ITEMS_COUNT - 1; i >= 0; i--)
+    {
+        u16 itemId = gSaveBlock1Ptr->pcItems[i].itemId;
+
+        if (itemId != ITEM_NONE && itemId < ITEMS_COUNT)
+            sPCItemSlotIndex[itemId] = i;
+    }
+}
+
+static void RebuildItemSlotIndex(void)
+{
+    u8 pocket;
+
+    for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+        UpdateBagPocketSlotIndex(pocket);
+    UpdatePCItemSlotIndex();
+    sItemSlotIndexValid = TRUE;
+}
+
+// Forces the next item query to rebuild the index. Must be called by anything that
+// rewrites bag or PC slots without going through this file's mutators.
+void InvalidateItemSlotIndex(void)
+{
+    sItemSlotIndexValid = FALSE;
+}
+
+// Returns the first slot of the pocket containing itemId, or the pocket capacity if there is none
+static u8 GetBagItemSlot(u8 pocket, u16 itemId)
+{
+    u8 slot;
+
+    if (itemId == ITEM_NONE || itemId >= ITEMS_COUNT)
+        return gBagPockets[pocket].capacity;
+    if (!sItemSlotIndexValid)
+        RebuildItemSlotIndex();
+
+    slot = sBagItemSlotIndex[itemId];
+    if (slot < gBagPockets[pocket].capacity && gBagPockets[pocket].itemSlots[slot].itemId == itemId)
+        return slot;
+    return gBagPockets[pocket].capacity;
+}
+
+// Returns the first PC slot containing itemId, or PC_ITEMS_COUNT if there is none
+static u8 GetPCItemSlot(u16 itemId)
+{
+    u8 slot;
+
+    if (itemId == ITEM_NONE || itemId >= ITEMS_COUNT)
+        return PC_ITEMS_COUNT;
+    if (!sItemSlotIndexValid)
+        RebuildItemSlotIndex();
+
+    slot = sPCItemSlotIndex[itemId];
+    if (slot < PC_ITEMS_COUNT && gSaveBlock1Ptr->pcItems[slot].itemId == itemId)
+        return slot;
+    return PC_ITEMS_COUNT;
+}
+
+static u8 GetBagPocketFreeSlots(u8 pocket)
+{
+    if (!sItemSlotIndexValid)
+        RebuildItemSlotIndex();
+    return sBagPocketFreeSlots[pocket];
+}
+
 void ApplyNewEncryptionKeyToBagItems(u32 newKey)
 {
     u32 pocket, item;
@@ -88,6 +187,8 @@ void SetBagItemsPointers(void)
 
     gBagPockets[BERRIES_POCKET].itemSlots = gSaveBlock1Ptr->bagPocket_Berries;
     gBagPockets[BERRIES_POCKET].capacity = BAG_BERRIES_COUNT;
+
+    InvalidateItemSlotIndex();
 }
 
 void CopyItemName(u16 itemId, u8 *dst)
@@ -153,7 +254,7 @@ bool8 CheckBagHasItem(u16 itemId, u16 count)
         return CheckPyramidBagHasItem(itemId, count);
     pocket = ItemId_GetPocket(itemId) - 1;
     // Check for item slots that contain the item
-    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    for (i = GetBagItemSlot(pocket, itemId); i < gBagPockets[pocket].capacity; i++)
     {
         if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
         {
@@ -209,7 +310,7 @@ bool8 CheckBagHasSpace(u16 itemId, u16 count)
         slotCapacity = MAX_BERRY_CAPACITY;
 
     // Check space in any existing item slots that already contain this item
-    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    for (i = GetBagItemSlot(pocket, itemId); i < gBagPockets[pocket].capacity; i++)
     {
         if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
         {
@@ -227,21 +328,18 @@ bool8 CheckBagHasSpace(u16 itemId, u16 count)
     // Check space in empty item slots
     if (count > 0)
     {
-        for (i = 0; i < gBagPockets[pocket].capacity; i++)
+        for (i = GetBagPocketFreeSlots(pocket); i != 0; i--)
         {
-            if (gBagPockets[pocket].itemSlots[i].itemId == 0)
+            if (count > slotCapacity)
             {
-                if (count > slotCapacity)
-                {
-                    if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
-                        return FALSE;
-                    count -= slotCapacity;
-                }
-                else
-                {
-                    count = 0; //should be return TRUE, but that doesn't match
-                    break;
-                }
+                if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
+                    return FALSE;
+                count -= slotCapacity;
+            }
+            else
+            {
+                count = 0; //should be return TRUE, but that doesn't match
+                break;
             }
         }
         if (count > 0)
@@ -280,7 +378,7 @@ bool8 AddBagItem(u16 itemId, u16 count)
         else
             slotCapacity = MAX_BERRY_CAPACITY;
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        for (i = GetBagItemSlot(pocket, itemId); i < itemPocket->capacity; i++)
         {
             if (newItems[i].itemId == itemId)
             {
@@ -354,6 +452,7 @@ bool8 AddBagItem(u16 itemId, u16 count)
         }
         memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
         Free(newItems);
+        UpdateBagPocketSlotIndex(pocket);
         return TRUE;
     }
 }
@@ -375,13 +474,15 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
     {
         u8 pocket;
         u8 var;
+        u8 firstSlot;
         u16 ownedCount;
         struct BagPocket *itemPocket;
 
         pocket = ItemId_GetPocket(itemId) - 1;
         itemPocket = &gBagPockets[pocket];
+        firstSlot = GetBagItemSlot(pocket, itemId);
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        for (i = firstSlot; i < itemPocket->capacity; i++)
         {
             if (itemPocket->itemSlots[i].itemId == itemId)
                 totalQuantity += GetBagItemQuantity(&itemPocket->itemSlots[i].quantity);
@@ -416,10 +517,13 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
                 itemPocket->itemSlots[var].itemId = ITEM_NONE;
 
             if (count == 0)
+            {
+                UpdateBagPocketSlotIndex(pocket);
                 return TRUE;
+            }
         }
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        for (i = firstSlot; i < itemPocket->capacity; i++)
         {
             if (itemPocket->itemSlots[i].itemId == itemId)
             {
@@ -439,9 +543,10 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
                     itemPocket->itemSlots[i].itemId = ITEM_NONE;
 
                 if (count == 0)
-                    return TRUE;
+                    break;
             }
         }
+        UpdateBagPocketSlotIndex(pocket);
         return TRUE;
     }
 }
@@ -460,6 +565,7 @@ void ClearItemSlots(struct ItemSlot *itemSlots, u8 itemCount)
         itemSlots[i].itemId = ITEM_NONE;
         SetBagItemQuantity(&itemSlots[i].quantity, 0);
     }
+    InvalidateItemSlotIndex();
 }
 
 static s32 FindFreePCItemSlot(void)
@@ -491,7 +597,7 @@ bool8 CheckPCHasItem(u16 itemId, u16 count)
 {
     u8 i;
 
-    for (i = 0; i < PC_ITEMS_COUNT; i++)
+    for (i = GetPCItemSlot(itemId); i < PC_ITEMS_COUNT; i++)
     {
         if (gSaveBlock1Ptr->pcItems[i].itemId == itemId && GetPCItemQuantity(&gSaveBlock1Ptr->pcItems[i].quantity) >= count)
             return TRUE;
@@ -511,7 +617,7 @@ bool8 AddPCItem(u16 itemId, u16 count)
     memcpy(newItems, gSaveBlock1Ptr->pcItems, sizeof(gSaveBlock1Ptr->pcItems));
 
     // Use any item slots that already contain this item
-    for (i = 0; i < PC_ITEMS_COUNT; i++)
+    for (i = GetPCItemSlot(itemId); i < PC_ITEMS_COUNT; i++)
     {
         if (newItems[i].itemId == itemId)
         {
@@ -553,6 +659,7 @@ bool8 AddPCItem(u16 itemId, u16 count)
     // Copy items back to the PC
     memcpy(gSaveBlock1Ptr->pcItems, newItems, sizeof(gSaveBlock1Ptr->pcItems));
     Free(newItems);
+    UpdatePCItemSlotIndex();
     return TRUE;
 }
 
@@ -583,6 +690,7 @@ void CompactPCItems(void)
             }
         }
     }
+    UpdatePCItemSlotIndex();
 }
 
 void SwapRegisteredBike(void)
@@ -626,6 +734,7 @@ void CompactItemsInBagPocket(struct BagPocket *bagPocket)
                 SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
         }
     }
+    UpdateBagPocketSlotIndex(bagPocket - gBagPockets);
 }
 
 void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
@@ -646,6 +755,7 @@ void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
             SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
         }
     }
+    UpdateBagPocketSlotIndex(bagPocket - gBagPockets);
 }
 
 void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
@@ -671,6 +781,7 @@ void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
                 itemSlots[i] = itemSlots[i - 1];
         }
         itemSlots[to] = firstSlot;
+        InvalidateItemSlotIndex();
     }
 }
 
@@ -688,9 +799,10 @@ u16 CountTotalItemQuantityInBag(u16 itemId)
 {
     u16 i;
     u16 ownedCount = 0;
-    struct BagPocket *bagPocket = &gBagPockets[ItemId_GetPocket(itemId) - 1];
+    u8 pocket = ItemId_GetPocket(itemId) - 1;
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
 
-    for (i = 0; i < bagPocket->capacity; i++)
+    for (i = GetBagItemSlot(pocket, itemId); i < bagPocket->capacity; i++)
     {
         if (bagPocket->itemSlots[i].itemId == itemId)
             ownedCount += GetBagItemQuantity(&bagPocket->itemSlots[i].quantity);
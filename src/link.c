@@ -8,6 +8,7 @@
 #include "librfu.h"
 #include "random.h"
 #include "decompress.h"
+#include "fieldmap.h"
 #include "string_util.h"
 #include "event_data.h"
 #include "item_menu.h"
@@ -1591,6 +1592,7 @@ void CB2_LinkError(void)
     m4aMPlayStop(&gMPlayInfo_SE1);
     m4aMPlayStop(&gMPlayInfo_SE2);
     m4aMPlayStop(&gMPlayInfo_SE3);
+    CancelTilesetPrefetches();
     InitHeap(gHeap, HEAP_SIZE);
     ResetSpriteData();
     FreeAllSpritePalettes();
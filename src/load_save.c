@@ -1,6 +1,7 @@
 #include "global.h"
 #include "malloc.h"
 #include "berry_powder.h"
+#include "fieldmap.h"
 #include "item.h"
 #include "load_save.h"
 #include "main.h"
@@ -89,6 +90,9 @@ void MoveSaveBlocks_ResetHeap(void)
     struct SaveBlock1 *saveBlock1Copy;
     struct PokemonStorage *pokemonStorageCopy;
 
+    // the heap is about to be overwritten, so drop anything still decompressing into it
+    CancelTilesetPrefetches();
+
     // save interrupt functions and turn them off
     vblankCB = gMain.vblankCallback;
     hblankCB = gMain.hblankCallback;
@@ -261,6 +265,8 @@ void SavePlayerBag(void)
     for (i = 0; i < BAG_BERRIES_COUNT; i++)
         gSaveBlock1Ptr->bagPocket_Berries[i] = gLoadedSaveData.berries[i];
 
+    InvalidateItemSlotIndex();
+
     // save mail.
     for (i = 0; i < MAIL_COUNT; i++)
         gSaveBlock1Ptr->mail[i] = gLoadedSaveData.mail[i];
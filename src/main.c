@@ -207,6 +207,7 @@ void SeedRngAndSetTrainerId(void)
 {
     u16 val = REG_TM1CNT_L;
     SeedRng(val);
+    SeedRngOverworld(val);
     REG_TM1CNT_H = 0;
     sTrainerId = val;
 }
@@ -230,6 +231,7 @@ static void SeedRngWithRtc(void)
     u32 seed = RtcGetMinuteCount();
     seed = (seed >> 16) ^ (seed & 0xFFFF);
     SeedRng(seed);
+    SeedRngOverworld(seed);
 }
 #endif
 
@@ -362,6 +364,8 @@ static void VBlankIntr(void)
 
     if (!gMain.inBattle || !(gBattleTypeFlags & (BATTLE_TYPE_LINK | BATTLE_TYPE_FRONTIER | BATTLE_TYPE_RECORDED)))
         Random();
+    // Nothing needs the overworld stream in step, so it always advances
+    RandomOverworld();
 
     UpdateWirelessStatusIndicatorSprite();
 
@@ -1745,41 +1745,29 @@ static void PopulateSpeciesFromTrainerLocation(int matchCallId, u8 *destStr)
     u16 species[2];
     int numSpecies;
     u8 slot;
-    int i = 0;
+    u16 i = GetWildMonHeaderIdByMap(gRematchTable[matchCallId].mapGroup, gRematchTable[matchCallId].mapNum);
 
-    if (gWildMonHeaders[i].mapGroup != MAP_GROUP(UNDEFINED)) // ??? This check is nonsense.
+    if (i != HEADER_NONE)
     {
-        while (gWildMonHeaders[i].mapGroup != MAP_GROUP(UNDEFINED))
+        numSpecies = 0;
+        if (gWildMonHeaders[i].landMonsInfo)
         {
-            if (gWildMonHeaders[i].mapGroup == gRematchTable[matchCallId].mapGroup
-             && gWildMonHeaders[i].mapNum == gRematchTable[matchCallId].mapNum)
-                break;
-
-            i++;
+            slot = GetLandEncounterSlot();
+            species[numSpecies] = gWildMonHeaders[i].landMonsInfo->wildPokemon[slot].species;
+            numSpecies++;
         }
 
-        if (gWildMonHeaders[i].mapGroup != MAP_GROUP(UNDEFINED))
+        if (gWildMonHeaders[i].waterMonsInfo)
         {
-            numSpecies = 0;
-            if (gWildMonHeaders[i].landMonsInfo)
-            {
-                slot = GetLandEncounterSlot();
-                species[numSpecies] = gWildMonHeaders[i].landMonsInfo->wildPokemon[slot].species;
-                numSpecies++;
-            }
-
-            if (gWildMonHeaders[i].waterMonsInfo)
-            {
-                slot = GetWaterEncounterSlot();
-                species[numSpecies] = gWildMonHeaders[i].waterMonsInfo->wildPokemon[slot].species;
-                numSpecies++;
-            }
+            slot = GetWaterEncounterSlot();
+            species[numSpecies] = gWildMonHeaders[i].waterMonsInfo->wildPokemon[slot].species;
+            numSpecies++;
+        }
 
-            if (numSpecies)
-            {
-                StringCopy(destStr, gSpeciesNames[species[Random() % numSpecies]]);
-                return;
-            }
+        if (numSpecies)
+        {
+            StringCopy(destStr, gSpeciesNames[species[Random() % numSpecies]]);
+            return;
         }
     }
 
@@ -1814,6 +1814,18 @@ void *DecompressAndCopyTileDataToVram(u8 bgId, const void *src, u32 size, u16 of
     return NULL;
 }
 
+// Like DecompressAndCopyTileDataToVram, for a heap buffer that was already decompressed
+void *CopyDecompressedTileDataToVram(u8 bgId, void *ptr, u32 size, u16 offset, u8 mode)
+{
+    if (sTempTileDataBufferIdx < ARRAY_COUNT(sTempTileDataBuffer))
+    {
+        copy_decompressed_tile_data_to_vram(bgId, ptr, size, offset, mode);
+        sTempTileDataBuffer[sTempTileDataBufferIdx++] = ptr;
+        return ptr;
+    }
+    return NULL;
+}
+
 void DecompressAndLoadBgGfxUsingHeap(u8 bgId, const void *src, u32 size, u16 offset, u8 mode)
 {
     u32 sizeOut;
@@ -1821,11 +1833,15 @@ void DecompressAndLoadBgGfxUsingHeap(u8 bgId, const void *src, u32 size, u16 off
     if (!size)
         size = sizeOut;
     if (ptr)
-    {
-        u8 taskId = CreateTask(task_free_buf_after_copying_tile_data_to_vram, 0);
-        gTasks[taskId].data[0] = copy_decompressed_tile_data_to_vram(bgId, ptr, size, offset, mode);
-        SetWordTaskArg(taskId, 1, (u32)ptr);
-    }
+        LoadDecompressedBgGfxUsingHeap(bgId, ptr, size, offset, mode);
+}
+
+// Copies a heap buffer that was already decompressed, and frees it once the copy is done
+void LoadDecompressedBgGfxUsingHeap(u8 bgId, void *ptr, u32 size, u16 offset, u8 mode)
+{
+    u8 taskId = CreateTask(task_free_buf_after_copying_tile_data_to_vram, 0);
+    gTasks[taskId].data[0] = copy_decompressed_tile_data_to_vram(bgId, ptr, size, offset, mode);
+    SetWordTaskArg(taskId, 1, (u32)ptr);
 }
 
 void task_free_buf_after_copying_tile_data_to_vram(u8 taskId)
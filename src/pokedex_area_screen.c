@@ -82,7 +82,7 @@ struct
     /*0x620*/ u16 specialAreaRegionMapSectionIds[MAX_AREA_MARKERS];
     /*0x660*/ struct Sprite *areaMarkerSprites[MAX_AREA_MARKERS];
     /*0x6E0*/ u16 numAreaMarkerSprites;
-    /*0x6E2*/ u16 alteringCaveCounter;
+    /*0x6E2*/ u16 alteringCaveCounter; // unused
     /*0x6E4*/ u16 alteringCaveId;
     /*0x6E8*/ u8 *screenSwitchState;
     /*0x6EC*/ struct RegionMap regionMap;
@@ -96,8 +96,7 @@ static void BuildAreaGlowTilemap(void);
 static void SetAreaHasMon(u16, u16);
 static void SetSpecialMapHasMon(u16, u16);
 static u16 GetRegionMapSectionId(u8, u8);
-static bool8 MapHasSpecies(const struct WildPokemonHeader *, u16);
-static bool8 MonListHasSpecies(const struct WildPokemonInfo *, u16, u16);
+static bool8 IsWildMonHeaderShown(u16);
 static void DoAreaGlow(void);
 static void Task_ShowPokedexAreaScreen(u8);
 static void CreateAreaMarkerSprites(void);
@@ -243,8 +242,8 @@ static void FindMapsWithMon(u16 species)
 {
     u16 i;
     struct Roamer *roamer;
+    const u16 *headerIds;
 
-    sPokedexAreaScreen->alteringCaveCounter = 0;
     sPokedexAreaScreen->alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
     if (sPokedexAreaScreen->alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
         sPokedexAreaScreen->alteringCaveId = 0;
@@ -285,18 +284,20 @@ static void FindMapsWithMon(u16 species)
         }
 
         // Add regular species to the area map
-        for (i = 0; gWildMonHeaders[i].mapGroup != MAP_GROUP(UNDEFINED); i++)
+        headerIds = gWildMonHeaderIdsBySpecies[species];
+        for (i = 0; headerIds != NULL && headerIds[i] != HEADER_NONE; i++)
         {
-            if (MapHasSpecies(&gWildMonHeaders[i], species))
+            const struct WildPokemonHeader *header = &gWildMonHeaders[headerIds[i]];
+            if (IsWildMonHeaderShown(headerIds[i]))
             {
-                switch (gWildMonHeaders[i].mapGroup)
+                switch (header->mapGroup)
                 {
                 case MAP_GROUP_TOWNS_AND_ROUTES:
-                    SetAreaHasMon(gWildMonHeaders[i].mapGroup, gWildMonHeaders[i].mapNum);
+                    SetAreaHasMon(header->mapGroup, header->mapNum);
                     break;
                 case MAP_GROUP_DUNGEONS:
                 case MAP_GROUP_SPECIAL_AREA:
-                    SetSpecialMapHasMon(gWildMonHeaders[i].mapGroup, gWildMonHeaders[i].mapNum);
+                    SetSpecialMapHasMon(header->mapGroup, header->mapNum);
                     break;
                 }
             }
@@ -375,45 +376,18 @@ static u16 GetRegionMapSectionId(u8 mapGroup, u8 mapNum)
     return Overworld_GetMapHeaderByGroupAndId(mapGroup, mapNum)->regionMapSectionId;
 }
 
-static bool8 MapHasSpecies(const struct WildPokemonHeader *info, u16 species)
+static bool8 IsWildMonHeaderShown(u16 headerId)
 {
+    const struct WildPokemonHeader *header = &gWildMonHeaders[headerId];
+
     // If this is a header for Altering Cave, skip it if it's not the current Altering Cave encounter set
-    if (GetRegionMapSectionId(info->mapGroup, info->mapNum) == MAPSEC_ALTERING_CAVE)
+    if (GetRegionMapSectionId(header->mapGroup, header->mapNum) == MAPSEC_ALTERING_CAVE)
     {
-        sPokedexAreaScreen->alteringCaveCounter++;
-        if (sPokedexAreaScreen->alteringCaveCounter != sPokedexAreaScreen->alteringCaveId + 1)
+        if (headerId - GetWildMonHeaderIdByMap(header->mapGroup, header->mapNum) != sPokedexAreaScreen->alteringCaveId)
             return FALSE;
     }
 
-    if (MonListHasSpecies(info->landMonsInfo, species, LAND_WILD_COUNT))
-        return TRUE;
-    if (MonListHasSpecies(info->waterMonsInfo, species, WATER_WILD_COUNT))
-        return TRUE;
-// When searching the fishing encounters, this incorrectly uses the size of the land encounters.
-// As a result it's reading out of bounds of the fishing encounters tables.
-#ifdef BUGFIX
-    if (MonListHasSpecies(info->fishingMonsInfo, species, FISH_WILD_COUNT))
-#else
-    if (MonListHasSpecies(info->fishingMonsInfo, species, LAND_WILD_COUNT))
-#endif
-        return TRUE;
-    if (MonListHasSpecies(info->rockSmashMonsInfo, species, ROCK_WILD_COUNT))
-        return TRUE;
-    return FALSE;
-}
-
-static bool8 MonListHasSpecies(const struct WildPokemonInfo *info, u16 species, u16 size)
-{
-    u16 i;
-    if (info != NULL)
-    {
-        for (i = 0; i < size; i++)
-        {
-            if (info->wildPokemon[i].species == species)
-                return TRUE;
-        }
-    }
-    return FALSE;
+    return TRUE;
 }
 
 static void BuildAreaGlowTilemap(void)
@@ -3441,13 +3441,12 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
     // Determine original trainer ID
     if (otIdType == OT_ID_RANDOM_NO_SHINY)
     {
-        u32 shinyValue;
-        do
-        {
-            // Choose random OT IDs until one that results in a non-shiny Pokémon
-            value = Random32();
-            shinyValue = GET_SHINY_VALUE(value, personality);
-        } while (shinyValue < SHINY_ODDS);
+        // Pick a random non-shiny shiny value and work the OT ID's upper half
+        // out from it, which is the same as drawing OT IDs until one isn't shiny
+        u32 shinyValue = SHINY_ODDS + RandomUniform(0x10000 - SHINY_ODDS);
+        u32 otIdLow = Random32() & 0xFFFF;
+
+        value = ((otIdLow ^ HIHALF(personality) ^ LOHALF(personality) ^ shinyValue) << 16) | otIdLow;
     }
     else if (otIdType == OT_ID_PRESET)
     {
@@ -3463,8 +3462,8 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
 #if P_FLAG_FORCE_NO_SHINY != 0
         if (FlagGet(P_FLAG_FORCE_NO_SHINY))
         {
-            while (GET_SHINY_VALUE(value, personality) < SHINY_ODDS)
-                personality = Random32();
+            if (GET_SHINY_VALUE(value, personality) < SHINY_ODDS)
+                personality = GeneratePersonality(species, MON_GENDERLESS, NUM_NATURES, 0, PERSONALITY_NOT_SHINY, value);
         }
 #endif
 #if P_FLAG_FORCE_SHINY != 0
@@ -3473,8 +3472,8 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
     #endif
         if (FlagGet(P_FLAG_FORCE_SHINY))
         {
-            while (GET_SHINY_VALUE(value, personality) >= SHINY_ODDS)
-                personality = Random32();
+            if (GET_SHINY_VALUE(value, personality) >= SHINY_ODDS)
+                personality = GeneratePersonality(species, MON_GENDERLESS, NUM_NATURES, 0, PERSONALITY_SHINY, value);
         }
 #endif
 #if P_FLAG_FORCE_SHINY != 0 || P_FLAG_FORCE_NO_SHINY != 0
@@ -3610,52 +3609,18 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
     GiveBoxMonInitialMoveset(boxMon);
 }
 
+#include "pokemon_personality.inc.c"
+
 void CreateMonWithNature(struct Pokemon *mon, u16 species, u8 level, u8 fixedIV, u8 nature)
 {
-    u32 personality;
-
-    do
-    {
-        personality = Random32();
-    }
-    while (nature != GetNatureFromPersonality(personality));
+    u32 personality = GeneratePersonality(species, MON_GENDERLESS, nature, 0, PERSONALITY_SHINY_ANY, 0);
 
     CreateMon(mon, species, level, fixedIV, TRUE, personality, OT_ID_PLAYER_ID, 0);
 }
 
 void CreateMonWithGenderNatureLetter(struct Pokemon *mon, u16 species, u8 level, u8 fixedIV, u8 gender, u8 nature, u8 unownLetter, u8 otIdType)
 {
-    u32 personality;
-    u8 genderRatio;
-
-    genderRatio = gSpeciesInfo[species].genderRatio;
-
-// Infinite loop protection
-    if ((genderRatio == MON_MALE) || (genderRatio == MON_FEMALE) || (genderRatio == MON_GENDERLESS))
-       gender = genderRatio;
-
-    if ((u8)(unownLetter - 1) < NUM_UNOWN_FORMS)
-    {
-        u16 actualLetter;
-
-        do
-        {
-            personality = Random32();
-            actualLetter = GET_UNOWN_LETTER(personality);
-        }
-        while (nature != GetNatureFromPersonality(personality)
-            || gender != GetGenderFromSpeciesAndPersonality(species, personality)
-            || actualLetter != unownLetter - 1);
-    }
-    else
-    {
-        do
-        {
-            personality = Random32();
-        }
-        while (nature != GetNatureFromPersonality(personality)
-            || gender != GetGenderFromSpeciesAndPersonality(species, personality));
-    }
+    u32 personality = GeneratePersonality(species, gender, nature, unownLetter, PERSONALITY_SHINY_ANY, 0);
 
     CreateMon(mon, species, level, fixedIV, 1, personality, otIdType, 0);
 }
@@ -3666,12 +3631,8 @@ void CreateMaleMon(struct Pokemon *mon, u16 species, u8 level)
     u32 personality;
     u32 otId;
 
-    do
-    {
-        otId = Random32();
-        personality = Random32();
-    }
-    while (GetGenderFromSpeciesAndPersonality(species, personality) != MON_MALE);
+    otId = Random32();
+    personality = GeneratePersonality(species, MON_MALE, NUM_NATURES, 0, PERSONALITY_SHINY_ANY, 0);
     CreateMon(mon, species, level, USE_RANDOM_IVS, TRUE, personality, OT_ID_PRESET, otId);
 }
 
@@ -3882,10 +3843,7 @@ void CreateMonWithEVSpreadNatureOTID(struct Pokemon *mon, u16 species, u8 level,
     u16 evAmount;
 
     // i is reused as personality value
-    do
-    {
-        i = Random32();
-    } while (nature != GetNatureFromPersonality(i));
+    i = GeneratePersonality(species, MON_GENDERLESS, nature, 0, PERSONALITY_SHINY_ANY, 0);
 
     CreateMon(mon, species, level, fixedIV, TRUE, i, OT_ID_PRESET, otId);
     evsBits = evSpread;
@@ -0,0 +1,100 @@
+// Included by pokemon.c, and by tools/personalitytest to check the builder on
+// the host against rejection sampling. Expects the includes of pokemon.c.
+
+// Lowest personality byte for the gender, and for the Unown letter if there
+// is one. The letter is taken mod 28, a multiple of 4, so its lowest two bits
+// always come straight from the letter.
+static u32 GeneratePersonalityLowByte(u32 lowStart, u32 lowEnd, bool32 hasLetter, u32 letter)
+{
+    u32 first;
+
+    if (!hasLetter)
+        return lowStart + RandomUniform(lowEnd - lowStart);
+
+    first = lowStart + ((letter - lowStart) & 3);
+    return first + 4 * RandomUniform((lowEnd - first + 3) / 4);
+}
+
+STATIC_ASSERT(NUM_NATURES == 25, NaturePersonalityBitsAssumeNumNatures)
+
+// Builds a personality value with the given nature, gender and Unown letter
+// that is or isn't shiny for otId. The value is picked uniformly from all of
+// the ones that qualify, exactly as drawing Random32() until one matches
+// would, but without the hundreds of draws (and divisions) that takes.
+// Pass NUM_NATURES for any nature, MON_GENDERLESS for any gender and 0 for
+// any letter. Letters start at 1, as in CreateMonWithGenderNatureLetter.
+u32 GeneratePersonality(u16 species, u8 gender, u8 nature, u8 unownLetter, u8 shininess, u32 otId)
+{
+    u32 genderRatio = gSpeciesInfo[species].genderRatio;
+    u32 letter = (u8)(unownLetter - 1);
+    bool32 hasLetter = (letter < NUM_UNOWN_FORMS);
+    u32 lowStart = 0, lowEnd = 0x100;
+    u32 personality, letterValue, natureBits;
+
+    // The gender only depends on the lowest byte
+    if (genderRatio != MON_MALE && genderRatio != MON_FEMALE && genderRatio != MON_GENDERLESS)
+    {
+        if (gender == MON_FEMALE)
+            lowEnd = genderRatio;
+        else if (gender == MON_MALE)
+            lowStart = genderRatio;
+    }
+    // No value has both, drop the gender rather than never returning
+    if (hasLetter && lowStart + ((letter - lowStart) & 3) >= lowEnd)
+    {
+        lowStart = 0;
+        lowEnd = 0x100;
+    }
+
+    if (shininess == PERSONALITY_SHINY)
+    {
+        // Too rare to draw for. Each shiny value has exactly one lower half
+        // and shiny value pair, so the upper half is worked out from those
+        // and only the remaining constraints are checked.
+        do
+        {
+            u32 lowHalf = (Random32() & 0xFF00) | GeneratePersonalityLowByte(lowStart, lowEnd, FALSE, 0);
+            u32 highHalf = lowHalf ^ HIHALF(otId) ^ LOHALF(otId) ^ RandomUniform(SHINY_ODDS);
+
+            personality = (highHalf << 16) | lowHalf;
+        }
+        while ((hasLetter && GET_UNOWN_LETTER(personality) != letter)
+            || (nature < NUM_NATURES && GetNatureFromPersonality(personality) != nature));
+        return personality;
+    }
+
+    for (;;)
+    {
+        personality = (Random32() & ~0xFF) | GeneratePersonalityLowByte(lowStart, lowEnd, hasLetter, letter);
+
+        if (hasLetter)
+        {
+            // Pick one of the 8-bit values that reduce to the letter and
+            // spread its upper bits over the other three bytes
+            letterValue = letter + NUM_UNOWN_FORMS * RandomUniform((0xFF - letter) / NUM_UNOWN_FORMS + 1);
+            personality &= ~0x03030300;
+            personality |= ((letterValue >> 2) & 3) << 8
+                         | ((letterValue >> 4) & 3) << 16
+                         | ((letterValue >> 6) & 3) << 24;
+        }
+
+        if (nature < NUM_NATURES)
+        {
+            // Bits 10-15 are solved for last. 1 << 10 is -1 mod 25, so each
+            // step up in them lowers the nature by one. Between 2 and 3 of
+            // their 64 values work; a random one of 3 candidates is tried,
+            // starting over if it's out of range to keep every result equally
+            // likely.
+            personality &= ~0xFC00;
+            natureBits = (GetNatureFromPersonality(personality) + NUM_NATURES - nature) % NUM_NATURES;
+            natureBits += NUM_NATURES * RandomUniform(3);
+            if (natureBits >= 64)
+                continue;
+            personality |= natureBits << 10;
+        }
+
+        if (shininess == PERSONALITY_NOT_SHINY && GET_SHINY_VALUE(otId, personality) < SHINY_ODDS)
+            continue;
+        return personality;
+    }
+}
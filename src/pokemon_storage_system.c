@@ -259,6 +259,10 @@ enum {
 // By default the limit is 40 (though in practice only 37 can be).
 #define MAX_MON_ICONS max(IN_BOX_COUNT + PARTY_SIZE + 1, 40)
 
+// Number of frames without input before the icons of the neighbouring
+// boxes start being loaded into the unused icon slots.
+#define MON_ICON_PREFETCH_DELAY 8
+
 // The maximum number of item icons that can appear on-screen while
 // moving held items. 1 in the cursor, and 2 more while switching
 // between 2 Pokémon with held items
@@ -461,6 +465,11 @@ struct PokemonStorageSystemData
     struct Sprite **releaseMonSpritePtr;
     u16 numIconsPerSpecies[MAX_MON_ICONS];
     u16 iconSpeciesList[MAX_MON_ICONS];
+    u32 iconLastUsed[MAX_MON_ICONS];
+    u32 iconUseCounter;
+    u32 iconPrefetchStart;
+    u8 iconPrefetchTimer;
+    u8 iconPrefetchPos;
     u16 boxSpecies[IN_BOX_COUNT];
     u32 boxPersonalities[IN_BOX_COUNT];
     u8 incomingBoxId;
@@ -557,6 +566,19 @@ struct PokemonStorageSystemData
     u8 displayMenuTilemapBuffer[0x800];
 };
 
+// Unencrypted copy of the data needed to draw a box slot and check releases.
+// See the Box summaries section below.
+struct BoxMonSummary
+{
+    u32 personality;
+    u32 otId;
+    u16 checksum;
+    u16 species; // As MON_DATA_SPECIES2, so eggs are SPECIES_EGG
+    u16 heldItem;
+    u8 markings;
+    u8 restrictedMoves; // One bit per entry of sRestrictedReleaseMoves
+};
+
 static u32 sItemIconGfxBuffer[98];
 
 EWRAM_DATA static u8 sPreviousBoxOption = 0;
@@ -576,6 +598,8 @@ EWRAM_DATA static u8 sMovingMonOrigBoxId = 0;
 EWRAM_DATA static u8 sMovingMonOrigBoxPos = 0;
 EWRAM_DATA static bool8 sAutoActionOn = 0;
 EWRAM_DATA static bool8 sJustOpenedBag = 0;
+EWRAM_DATA static struct BoxMonSummary sBoxMonSummaries[TOTAL_BOXES_COUNT][IN_BOX_COUNT] = {0};
+EWRAM_DATA static u32 sBoxMonSummaryValid[TOTAL_BOXES_COUNT] = {0}; // One bit per box position
 
 // Main tasks
 static void Task_InitPokeStorage(u8);
@@ -654,6 +678,8 @@ static void SetMovingMonPriority(u8);
 static void SpriteCB_HeldMon(struct Sprite *);
 static struct Sprite *CreateMonIconSprite(u16, u32, s16, s16, u8, u8);
 static void DestroyBoxMonIcon(struct Sprite *);
+static void ResetMonIconPrefetch(void);
+static void TryPrefetchNeighbourBoxIcons(void);
 
 // Pokémon data
 static void MoveMon(void);
@@ -671,6 +697,8 @@ static void InitCanReleaseMonVars(void);
 static void ReleaseMon(void);
 static bool32 AtLeastThreeUsableMons(void);
 static s8 RunCanReleaseMon(void);
+static const struct BoxMonSummary *GetBoxMonSummaryAt(u8, u8);
+static void InvalidateBoxMonSummaryAt(u8, u8);
 static void SaveMovingMon(void);
 static void LoadSavedMovingMon(void);
 static void InitSummaryScreenData(void);
@@ -1406,7 +1434,7 @@ u8 CountMonsInBox(u8 boxId)
 
     for (i = 0, count = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) != SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i)->species != SPECIES_NONE)
             count++;
     }
 
@@ -1419,7 +1447,7 @@ s16 GetFirstFreeBoxSpot(u8 boxId)
 
     for (i = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) == SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i)->species == SPECIES_NONE)
             return i;
     }
 
@@ -1754,6 +1782,7 @@ void ResetPokemonStorageSystem(void)
         SetBoxWallpaper(boxId, boxId % (MAX_DEFAULT_WALLPAPER + 1));
 
     ResetWaldaWallpaper();
+    ResetBoxMonSummaries();
 }
 
 
@@ -2277,10 +2306,18 @@ enum {
 
 static void Task_PokeStorageMain(u8 taskId)
 {
+    u8 input;
+
     switch (sStorage->state)
     {
     case MSTATE_HANDLE_INPUT:
-        switch (HandleInput())
+        input = HandleInput();
+        if (input == INPUT_NONE)
+            TryPrefetchNeighbourBoxIcons();
+        else
+            ResetMonIconPrefetch();
+
+        switch (input)
         {
         case INPUT_MOVE_CURSOR:
             PlaySE(SE_SELECT);
@@ -4427,6 +4464,10 @@ static void InitMonIconFields(void)
         sStorage->numIconsPerSpecies[i] = 0;
     for (i = 0; i < MAX_MON_ICONS; i++)
         sStorage->iconSpeciesList[i] = SPECIES_NONE;
+    for (i = 0; i < MAX_MON_ICONS; i++)
+        sStorage->iconLastUsed[i] = 0;
+    sStorage->iconUseCounter = 0;
+    ResetMonIconPrefetch();
     for (i = 0; i < PARTY_SIZE; i++)
         sStorage->partySprites[i] = NULL;
     for (i = 0; i < IN_BOX_COUNT; i++)
@@ -4455,8 +4496,7 @@ static void InitBoxMonSprites(u8 boxId)
 {
     u8 boxPosition;
     u16 i, j, count;
-    u16 species;
-    u32 personality;
+    const struct BoxMonSummary *summary;
 
     count = 0;
     boxPosition = 0;
@@ -4466,11 +4506,10 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            species = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES2);
-            if (species != SPECIES_NONE)
+            summary = GetBoxMonSummaryAt(boxId, boxPosition);
+            if (summary->species != SPECIES_NONE)
             {
-                personality = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
-                sStorage->boxMonsSprites[count] = CreateMonIconSprite(species, personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
+                sStorage->boxMonsSprites[count] = CreateMonIconSprite(summary->species, summary->personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
             }
             else
             {
@@ -4486,7 +4525,7 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
         {
-            if (GetBoxMonDataAt(boxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
+            if (GetBoxMonSummaryAt(boxId, boxPosition)->heldItem == ITEM_NONE)
                 sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
         }
     }
@@ -4494,15 +4533,14 @@ static void InitBoxMonSprites(u8 boxId)
 
 static void CreateBoxMonIconAtPos(u8 boxPosition)
 {
-    u16 species = GetCurrentBoxMonData(boxPosition, MON_DATA_SPECIES2);
+    const struct BoxMonSummary *summary = GetBoxMonSummaryAt(StorageGetCurrentBox(), boxPosition);
 
-    if (species != SPECIES_NONE)
+    if (summary->species != SPECIES_NONE)
     {
         s16 x = 8 * (3 * (boxPosition % IN_BOX_COLUMNS)) + 100;
         s16 y = 8 * (3 * (boxPosition / IN_BOX_COLUMNS)) + 44;
-        u32 personality = GetCurrentBoxMonData(boxPosition, MON_DATA_PERSONALITY);
 
-        sStorage->boxMonsSprites[boxPosition] = CreateMonIconSprite(species, personality, x, y, 2, 19 - (boxPosition % IN_BOX_COLUMNS));
+        sStorage->boxMonsSprites[boxPosition] = CreateMonIconSprite(summary->species, summary->personality, x, y, 2, 19 - (boxPosition % IN_BOX_COLUMNS));
         if (sStorage->boxOption == OPTION_MOVE_ITEMS)
             sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
     }
@@ -4632,7 +4670,7 @@ static u8 CreateBoxMonIconsInColumn(u8 column, u16 distance, s16 speed)
                     sStorage->boxMonsSprites[boxPosition]->sSpeed = speed;
                     sStorage->boxMonsSprites[boxPosition]->sScrollInDestX = xDest;
                     sStorage->boxMonsSprites[boxPosition]->callback = SpriteCB_BoxMonIconScrollIn;
-                    if (GetBoxMonDataAt(sStorage->incomingBoxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
+                    if (GetBoxMonSummaryAt(sStorage->incomingBoxId, boxPosition)->heldItem == ITEM_NONE)
                         sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
                     iconsCreated++;
                 }
@@ -4728,9 +4766,11 @@ static void GetIncomingBoxMonData(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            sStorage->boxSpecies[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES2);
+            const struct BoxMonSummary *summary = GetBoxMonSummaryAt(boxId, boxPosition);
+
+            sStorage->boxSpecies[boxPosition] = summary->species;
             if (sStorage->boxSpecies[boxPosition] != SPECIES_NONE)
-                sStorage->boxPersonalities[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
+                sStorage->boxPersonalities[boxPosition] = summary->personality;
             boxPosition++;
         }
     }
@@ -5104,68 +5144,147 @@ static void SpriteCB_HeldMon(struct Sprite *sprite)
     sprite->y = sStorage->cursorSprite->y + sStorage->cursorSprite->y2 + 4;
 }
 
-static u16 TryLoadMonIconTiles(u16 species, u32 personality)
+// The icon tiles loaded into the MAX_MON_ICONS slots at the start of OBJ VRAM
+// are cached. iconSpeciesList holds the icon species loaded into each slot and
+// numIconsPerSpecies the number of sprites using it. Slots no sprite uses keep
+// their tiles until the space is needed for another icon, so icons shared
+// between boxes aren't copied from ROM again when scrolling.
+static u16 GetMonIconCacheKey(u16 species, u32 personality)
 {
-    u16 i, offset;
-
     // Treat female mons as a seperate species as they may have a different icon than males
     if (ShouldShowFemaleDifferences(species, personality))
         species |= 0x8000; // 1 << 15
 
-    // Search icon list for this species
+    return species;
+}
+
+static s32 FindMonIconSlot(u16 key)
+{
+    s32 i;
+
     for (i = 0; i < MAX_MON_ICONS; i++)
     {
-        if (sStorage->iconSpeciesList[i] == species)
-            break;
+        if (sStorage->iconSpeciesList[i] == key)
+            return i;
+    }
+    return -1;
+}
+
+// Returns an empty slot if there is one, otherwise the least recently used slot
+// that no sprite is using and that hasn't been used since minLastUsed.
+static s32 FindFreeMonIconSlot(u32 minLastUsed)
+{
+    s32 i, slot = -1;
+
+    for (i = 0; i < MAX_MON_ICONS; i++)
+    {
+        if (sStorage->iconSpeciesList[i] == SPECIES_NONE)
+            return i;
+        if (sStorage->numIconsPerSpecies[i] == 0
+         && sStorage->iconLastUsed[i] < minLastUsed
+         && (slot == -1 || sStorage->iconLastUsed[i] < sStorage->iconLastUsed[slot]))
+            slot = i;
     }
+    return slot;
+}
+
+static void LoadMonIconTilesToSlot(u8 slot, u16 key, u32 personality)
+{
+    sStorage->iconSpeciesList[slot] = key;
+    CpuCopy32(GetMonIconTiles(key & GENDER_MASK, personality), (void *)(OBJ_VRAM0) + 16 * slot * TILE_SIZE_4BPP, 0x200);
+}
 
-    if (i == MAX_MON_ICONS)
+static u16 TryLoadMonIconTiles(u16 species, u32 personality)
+{
+    s32 i;
+    u16 key = GetMonIconCacheKey(species, personality);
+
+    // Search icon list for this species
+    i = FindMonIconSlot(key);
+    if (i == -1)
     {
         // Species not present in the list
-        // Find first empty spot in the list to put it
-        for (i = 0; i < MAX_MON_ICONS; i++)
-        {
-            if (sStorage->iconSpeciesList[i] == 0)
-                break;
-        }
+        // Find a slot to load it into
+        i = FindFreeMonIconSlot(sStorage->iconUseCounter + 1);
 
-        // Failed to find an empty spot
-        if (i == MAX_MON_ICONS)
+        // Failed to find a slot
+        if (i == -1)
             return 0xFFFF;
+
+        LoadMonIconTilesToSlot(i, key, personality);
     }
 
-    // Add species to icon list and load tiles
-    sStorage->iconSpeciesList[i] = species;
     sStorage->numIconsPerSpecies[i]++;
-    offset = 16 * i;
-    species &= GENDER_MASK;
-    CpuCopy32(GetMonIconTiles(species, personality), (void *)(OBJ_VRAM0) + offset * TILE_SIZE_4BPP, 0x200);
+    sStorage->iconLastUsed[i] = ++sStorage->iconUseCounter;
 
-    return offset;
+    return 16 * i;
 }
 
-static void RemoveSpeciesFromIconList(u16 species)
+static void RemoveSpeciesFromIconList(u16 key)
 {
-    u16 i;
-    bool8 hasFemale = FALSE;
+    s32 i = FindMonIconSlot(key);
 
-    for (i = 0; i < MAX_MON_ICONS; i++)
+    // The tiles are kept loaded for reuse, see TryLoadMonIconTiles
+    if (i != -1 && sStorage->numIconsPerSpecies[i] != 0)
+        sStorage->numIconsPerSpecies[i]--;
+}
+
+static void ResetMonIconPrefetch(void)
+{
+    sStorage->iconPrefetchTimer = 0;
+    sStorage->iconPrefetchPos = 0;
+}
+
+// Called every frame the player is idle in the box. After a short delay this loads
+// the icons of the boxes on either side of the current one into unused icon slots,
+// one per frame, so scrolling to them doesn't need to copy them. Icons loaded this
+// way don't evict each other, so it stops once the slots from before it started are used up.
+static void TryPrefetchNeighbourBoxIcons(void)
+{
+    u8 boxId, boxPosition;
+    u16 species, key;
+    s32 slot;
+    const struct BoxMonSummary *summary;
+
+    if (sStorage->iconPrefetchTimer < MON_ICON_PREFETCH_DELAY)
     {
-        if (sStorage->iconSpeciesList[i] == (species | 0x8000))
-        {
-            hasFemale = TRUE;
-            break;
-        }
+        if (++sStorage->iconPrefetchTimer == MON_ICON_PREFETCH_DELAY)
+            sStorage->iconPrefetchStart = sStorage->iconUseCounter + 1;
+        return;
     }
 
-    for (i = 0; i < MAX_MON_ICONS; i++)
+    while (sStorage->iconPrefetchPos < IN_BOX_COUNT * 2)
     {
-        if (sStorage->iconSpeciesList[i] == species && !hasFemale)
+        // Alternate between the next and the previous box
+        boxPosition = sStorage->iconPrefetchPos / 2;
+        if (sStorage->iconPrefetchPos % 2 == 0)
+            boxId = (StorageGetCurrentBox() + 1) % TOTAL_BOXES_COUNT;
+        else
+            boxId = (StorageGetCurrentBox() + TOTAL_BOXES_COUNT - 1) % TOTAL_BOXES_COUNT;
+        sStorage->iconPrefetchPos++;
+
+        summary = GetBoxMonSummaryAt(boxId, boxPosition);
+        if (summary->species == SPECIES_NONE)
+            continue;
+
+        species = GetIconSpecies(summary->species, summary->personality);
+        key = GetMonIconCacheKey(species, summary->personality);
+        slot = FindMonIconSlot(key);
+        if (slot == -1)
         {
-            if (--sStorage->numIconsPerSpecies[i] == 0)
-                sStorage->iconSpeciesList[i] = SPECIES_NONE;
-            break;
+            slot = FindFreeMonIconSlot(sStorage->iconPrefetchStart);
+            if (slot == -1)
+            {
+                // Out of tile space
+                sStorage->iconPrefetchPos = IN_BOX_COUNT * 2;
+                break;
+            }
+            LoadMonIconTilesToSlot(slot, key, summary->personality);
         }
+        sStorage->iconLastUsed[slot] = ++sStorage->iconUseCounter;
+
+        // Only load one icon per frame
+        break;
     }
 }
 
@@ -5192,13 +5311,13 @@ static struct Sprite *CreateMonIconSprite(u16 species, u32 personality, s16 x, s
     spriteId = CreateSprite(&template, x, y, subpriority);
     if (spriteId == MAX_SPRITES)
     {
-        RemoveSpeciesFromIconList(species);
+        RemoveSpeciesFromIconList(GetMonIconCacheKey(species, personality));
         return NULL;
     }
 
     gSprites[spriteId].oam.tileNum = tileNum;
     gSprites[spriteId].oam.priority = oamPriority;
-    gSprites[spriteId].data[0] = species;
+    gSprites[spriteId].data[0] = GetMonIconCacheKey(species, personality);
     return &gSprites[spriteId];
 }
 
@@ -6543,21 +6662,31 @@ struct
     {MAP_GROUP(EVER_GRANDE_CITY_POKEMON_LEAGUE_2F), MAP_NUM(EVER_GRANDE_CITY_POKEMON_LEAGUE_2F), MOVE_ROCK_SMASH},
 };
 
+// Lists the move of every entry above, so that MON_DATA_KNOWN_MOVES
+// returns one bit per entry regardless of the current map.
 static void GetRestrictedReleaseMoves(u16 *moves)
 {
     s32 i;
 
+    for (i = 0; i < ARRAY_COUNT(sRestrictedReleaseMoves); i++)
+        moves[i] = sRestrictedReleaseMoves[i].move;
+    moves[i] = MOVES_COUNT;
+}
+
+// Returns the bits of the entries above that apply on the current map
+static u8 GetActiveRestrictedReleaseMoves(void)
+{
+    s32 i;
+    u8 activeMoves = 0;
+
     for (i = 0; i < ARRAY_COUNT(sRestrictedReleaseMoves); i++)
     {
         if (sRestrictedReleaseMoves[i].mapGroup == MAP_GROUPS_COUNT
         || (sRestrictedReleaseMoves[i].mapGroup == gSaveBlock1Ptr->location.mapGroup
          && sRestrictedReleaseMoves[i].mapNum == gSaveBlock1Ptr->location.mapNum))
-        {
-            *moves = sRestrictedReleaseMoves[i].move;
-            moves++;
-        }
+            activeMoves |= 1 << i;
     }
-    *moves = MOVES_COUNT;
+    return activeMoves;
 }
 
 static void InitCanReleaseMonVars(void)
@@ -6593,7 +6722,8 @@ static void InitCanReleaseMonVars(void)
     }
 
     GetRestrictedReleaseMoves(sStorage->restrictedMoveList);
-    sStorage->restrictedReleaseMonMoves = GetMonData(&sStorage->tempMon, MON_DATA_KNOWN_MOVES, (u8 *)sStorage->restrictedMoveList);
+    sStorage->restrictedReleaseMonMoves = GetMonData(&sStorage->tempMon, MON_DATA_KNOWN_MOVES, (u8 *)sStorage->restrictedMoveList)
+                                        & GetActiveRestrictedReleaseMoves();
     if (sStorage->restrictedReleaseMonMoves != 0)
     {
         // Pokémon knows at least one restricted release move
@@ -6682,9 +6812,9 @@ static s8 RunCanReleaseMon(void)
     case 1:
         // Check PC for other Pokémon that know any restricted
         // moves the release Pokémon knows
-        for (i = 0; i < IN_BOX_COUNT; i++)
+        for (i = 0; i < IN_BOX_COUNT && !sStorage->releaseStatusResolved; i++)
         {
-            knownMoves = GetAndCopyBoxMonDataAt(sStorage->releaseCheckBoxId, sStorage->releaseCheckBoxPos, MON_DATA_KNOWN_MOVES, (u8 *)sStorage->restrictedMoveList);
+            knownMoves = GetBoxMonSummaryAt(sStorage->releaseCheckBoxId, sStorage->releaseCheckBoxPos)->restrictedMoves;
             if (knownMoves != 0 && !(sStorage->releaseBoxId == sStorage->releaseCheckBoxId
                                   && sStorage->releaseBoxPos == sStorage->releaseCheckBoxPos))
             {
@@ -9447,6 +9577,73 @@ static void SpriteCB_ItemIcon_HideParty(struct Sprite *sprite)
 #undef sCursorPos
 
 
+//------------------------------------------------------------------------------
+//  SECTION: Box summaries
+//
+//  An unencrypted copy of each storage slot's species, personality, held item,
+//  markings and restricted release moves, so that drawing a box or checking
+//  whether a Pokémon can be released doesn't need to decrypt every Pokémon.
+//  The write functions in General utility invalidate the slots they change.
+//  Entries are also tagged with the Pokémon's unencrypted personality, OT id,
+//  checksum and markings, so writes made directly to the boxes elsewhere
+//  (e.g. SendMonToPC) are picked up the next time the slot is read.
+//------------------------------------------------------------------------------
+
+
+static void UpdateBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    struct BoxPokemon *boxMon = &gPokemonStoragePtr->boxes[boxId][boxPosition];
+    struct BoxMonSummary *summary = &sBoxMonSummaries[boxId][boxPosition];
+    u16 moves[ARRAY_COUNT(sRestrictedReleaseMoves) + 1];
+
+    summary->species = GetBoxMonData(boxMon, MON_DATA_SPECIES2);
+    if (summary->species != SPECIES_NONE)
+    {
+        GetRestrictedReleaseMoves(moves);
+        summary->heldItem = GetBoxMonData(boxMon, MON_DATA_HELD_ITEM);
+        summary->restrictedMoves = GetBoxMonData(boxMon, MON_DATA_KNOWN_MOVES, (u8 *)moves);
+    }
+    else
+    {
+        summary->heldItem = ITEM_NONE;
+        summary->restrictedMoves = 0;
+    }
+
+    // Read the tags last, GetBoxMonData may flag the Pokémon as a bad egg
+    summary->personality = boxMon->personality;
+    summary->otId = boxMon->otId;
+    summary->checksum = boxMon->checksum;
+    summary->markings = boxMon->markings;
+    sBoxMonSummaryValid[boxId] |= 1 << boxPosition;
+}
+
+static const struct BoxMonSummary *GetBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    struct BoxPokemon *boxMon = &gPokemonStoragePtr->boxes[boxId][boxPosition];
+    struct BoxMonSummary *summary = &sBoxMonSummaries[boxId][boxPosition];
+
+    if (!(sBoxMonSummaryValid[boxId] & (1 << boxPosition))
+     || summary->personality != boxMon->personality
+     || summary->otId != boxMon->otId
+     || summary->checksum != boxMon->checksum
+     || summary->markings != boxMon->markings)
+        UpdateBoxMonSummaryAt(boxId, boxPosition);
+
+    return summary;
+}
+
+static void InvalidateBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    sBoxMonSummaryValid[boxId] &= ~(1 << boxPosition);
+}
+
+// Called when the storage is loaded or reset, entries are rebuilt as they're read
+void ResetBoxMonSummaries(void)
+{
+    memset(sBoxMonSummaryValid, 0, sizeof(sBoxMonSummaryValid));
+}
+
+
 //------------------------------------------------------------------------------
 //  SECTION: General utility
 //------------------------------------------------------------------------------
@@ -9487,7 +9684,10 @@ u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request)
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         SetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], request, value);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 u32 GetCurrentBoxMonData(u8 boxPosition, s32 request)
@@ -9525,7 +9725,10 @@ u32 GetBoxMonLevelAt(u8 boxId, u8 boxPosition)
 void SetBoxMonNickAt(u8 boxId, u8 boxPosition, const u8 *nick)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         SetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], MON_DATA_NICKNAME, nick);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 u32 GetAndCopyBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, void *dst)
@@ -9539,7 +9742,10 @@ u32 GetAndCopyBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, void *dst)
 void SetBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon *src)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         gPokemonStoragePtr->boxes[boxId][boxPosition] = *src;
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 void CopyBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon *dst)
@@ -9558,13 +9764,17 @@ void CreateBoxMonAt(u8 boxId, u8 boxPosition, u16 species, u8 level, u8 fixedIV,
                      fixedIV,
                      hasFixedPersonality, personality,
                      otIDType, otID);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
     }
 }
 
 void ZeroBoxMonAt(u8 boxId, u8 boxPosition)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         ZeroBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition]);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 void BoxMonAtToMon(u8 boxId, u8 boxPosition, struct Pokemon *dst)
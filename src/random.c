@@ -8,6 +8,8 @@ EWRAM_DATA static u32 sRandCount = 0;
 u32 gRngValue;
 u32 gRng2Value;
 
+EWRAM_DATA u32 gRngOverworldValue = 0;
+
 u16 Random(void)
 {
     gRngValue = ISO_RANDOMIZE1(gRngValue);
@@ -21,6 +23,13 @@ void SeedRng(u16 seed)
     sUnknown = 0;
 }
 
+// Only seeded at boot, so that link code and record mixing reseeding the
+// battle stream leave the overworld one alone.
+void SeedRngOverworld(u16 seed)
+{
+    gRngOverworldValue = ISO_RANDOMIZE2(seed);
+}
+
 void SeedRng2(u16 seed)
 {
     gRng2Value = seed;
@@ -31,3 +40,72 @@ u16 Random2(void)
     gRng2Value = ISO_RANDOMIZE1(gRng2Value);
     return gRng2Value >> 16;
 }
+
+u16 RandomOverworld(void)
+{
+    gRngOverworldValue = ISO_RANDOMIZE2(gRngOverworldValue);
+    return gRngOverworldValue >> 16;
+}
+
+static inline u16 RandomFromStream(u8 stream)
+{
+    if (stream == RNG_STREAM_OVERWORLD)
+        return RandomOverworld();
+    return Random();
+}
+
+// Multiply-shift reduction: the upper half of random * n is in [0, n). The
+// few random values that would make some results more likely than others all
+// leave the lower half below n, so the division that finds them exactly is
+// only needed in that case, at most n / 0x10000 of the time.
+u32 RandomUniformFromStream(u8 stream, u32 n)
+{
+    u32 product;
+
+    if (n == 0)
+        return 0;
+
+    product = RandomFromStream(stream) * n;
+    if ((product & 0xFFFF) < n)
+    {
+        u32 threshold = (0x10000 - n) % n;
+
+        while ((product & 0xFFFF) < threshold)
+            product = RandomFromStream(stream) * n;
+    }
+    return product >> 16;
+}
+
+u32 RandomRangeFromStream(u8 stream, u32 lo, u32 hi)
+{
+    if (hi <= lo)
+        return lo;
+    return lo + RandomUniformFromStream(stream, hi - lo + 1);
+}
+
+bool32 RandomPercentFromStream(u8 stream, u32 percent)
+{
+    return RandomUniformFromStream(stream, 100) < percent;
+}
+
+u32 RandomWeightedFromStream(u8 stream, const u16 *cumulativeWeights, u32 count)
+{
+    u32 lo = 0, hi = count - 1;
+    u32 value;
+
+    if (count == 0)
+        return 0;
+
+    value = RandomUniformFromStream(stream, cumulativeWeights[count - 1]);
+    // First entry whose running total is above the value
+    while (lo < hi)
+    {
+        u32 mid = (lo + hi) / 2;
+
+        if (value < cumulativeWeights[mid])
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
@@ -2,6 +2,7 @@
 #include "agb_flash.h"
 #include "gba/flash_internal.h"
 #include "fieldmap.h"
+#include "item.h"
 #include "save.h"
 #include "task.h"
 #include "decompress.h"
@@ -14,6 +15,7 @@
 #include "constants/game_stat.h"
 
 static u16 CalculateChecksum(void *, u16);
+static u32 CalculateSectorHash(void *, u16);
 static bool8 ReadFlashSector(u8, struct SaveSector *);
 static u8 GetSaveValidStatus(const struct SaveSectorLocation *);
 static u8 CopySaveSlotData(u16, struct SaveSectorLocation *);
@@ -39,6 +41,12 @@ static u8 HandleReplaceSector(u16, const struct SaveSectorLocation *);
  * might be done to reduce wear on the flash memory, but I'm not sure, since all
  * 14 sectors get written anyway.
  *
+ * Sectors whose data hasn't changed since their save slot was last written are
+ * skipped, and the SaveBlock2 sector (which is always written) records which save
+ * each sector of the slot belongs to. Skipping sectors requires keeping the slot's
+ * layout, so the layout is only rotated every SLOT_WRITES_PER_ROTATION writes of a
+ * slot, when all of its sectors are written.
+ *
  * See SECTOR_ID_* constants in save.h
  */
 
@@ -79,6 +87,20 @@ STATIC_ASSERT(sizeof(struct SaveBlock2) <= SECTOR_DATA_SIZE, SaveBlock2FreeSpace
 STATIC_ASSERT(sizeof(struct SaveBlock1) <= SECTOR_DATA_SIZE * (SECTOR_ID_SAVEBLOCK1_END - SECTOR_ID_SAVEBLOCK1_START + 1), SaveBlock1FreeSpace);
 STATIC_ASSERT(sizeof(struct PokemonStorage) <= SECTOR_DATA_SIZE * (SECTOR_ID_PKMN_STORAGE_END - SECTOR_ID_PKMN_STORAGE_START + 1), PokemonStorageFreeSpace);
 
+#define SLOT_WRITES_PER_ROTATION 8
+
+// What is currently written in each save slot, as far as the game knows.
+// A sector is clean if its hash and checksum match the data in flash.
+struct SaveSlotState
+{
+    u16 firstSector; // The value of gLastWrittenSector the slot was written with
+    u16 cleanSectors;
+    bool8 countersKnown;
+    u32 counters[NUM_SECTORS_PER_SLOT];
+    u32 hashes[NUM_SECTORS_PER_SLOT];
+    u16 checksums[NUM_SECTORS_PER_SLOT];
+};
+
 u16 gLastWrittenSector;
 u32 gLastSaveCounter;
 u16 gLastKnownGoodSector;
@@ -95,11 +117,113 @@ u16 gSaveAttemptStatus;
 
 EWRAM_DATA struct SaveSector gSaveDataBuffer = {0}; // Buffer used for reading/writing sectors
 EWRAM_DATA static u8 sUnusedVar = 0;
+EWRAM_DATA static struct SaveSlotState sSaveSlotStates[NUM_SAVE_SLOTS] = {0};
+EWRAM_DATA u8 gSaveSectorsWritten = 0; // Number of sectors written by the last save, for debugging
+
+static void ResetSaveSlotState(u8 slotId)
+{
+    sSaveSlotStates[slotId].cleanSectors = 0;
+    sSaveSlotStates[slotId].countersKnown = FALSE;
+}
+
+static void ResetSaveSlotStates(void)
+{
+    u8 i;
+
+    for (i = 0; i < NUM_SAVE_SLOTS; i++)
+        ResetSaveSlotState(i);
+}
+
+// The counter a sector of the current save slot gets written with
+static u32 GetSectorCounter(u16 sectorId)
+{
+    struct SaveSlotState *slot = &sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS];
+
+    if (slot->countersKnown)
+        return slot->counters[sectorId];
+    return gSaveCounter;
+}
+
+static void SetSectorFooter(u16 sectorId)
+{
+    struct SaveSlotState *slot = &sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS];
+    u16 i;
+
+    gReadWriteSector->id = sectorId;
+    gReadWriteSector->signature = SECTOR_SIGNATURE;
+    gReadWriteSector->counter = GetSectorCounter(sectorId);
+
+    // If the counters of the slot's other sectors aren't known they
+    // must all be the same, so the manifest is left out.
+    if (sectorId == SECTOR_ID_SAVEBLOCK2 && slot->countersKnown)
+    {
+        gReadWriteSector->manifest.signature = SAVE_MANIFEST_SIGNATURE;
+        for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+            gReadWriteSector->manifest.sectorCounters[i] = slot->counters[i];
+    }
+}
+
+// Data was written to a sector of the current save slot, record it so the
+// sector can be skipped by later saves if its data doesn't change.
+static void SetSectorWritten(u16 sectorId, void *data, u16 size, bool8 complete)
+{
+    struct SaveSlotState *slot = &sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS];
+
+    slot->checksums[sectorId] = CalculateChecksum(data, size);
+    slot->hashes[sectorId] = CalculateSectorHash(data, size);
+    if (complete)
+        slot->cleanSectors |= 1 << sectorId;
+    else
+        slot->cleanSectors &= ~(1 << sectorId);
+    gSaveSectorsWritten++;
+}
+
+// A sector written by HandleReplaceSector is complete once the first byte of its signature is written
+static void SetSectorSignatureWritten(u16 sectorId)
+{
+    if (sectorId < NUM_SECTORS_PER_SLOT)
+        sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS].cleanSectors |= 1 << sectorId;
+}
+
+static bool32 IsSectorUnchanged(struct SaveSlotState *slot, u16 sectorId, const struct SaveSectorLocation *locations)
+{
+    if (!(slot->cleanSectors & (1 << sectorId)))
+        return FALSE;
+    if (slot->checksums[sectorId] != CalculateChecksum(locations[sectorId].data, locations[sectorId].size))
+        return FALSE;
+    return slot->hashes[sectorId] == CalculateSectorHash(locations[sectorId].data, locations[sectorId].size);
+}
+
+// Prepares the current save slot for a new save, marking every sector that needs to be written.
+// The SaveBlock2 sector is always written, as it holds the slot's manifest.
+static void SetSaveSlotDirtySectors(bool8 allSectors, const struct SaveSectorLocation *locations)
+{
+    struct SaveSlotState *slot = &sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS];
+    u16 i;
+
+    if (allSectors || !slot->countersKnown)
+        slot->cleanSectors = 0;
+    else
+        slot->cleanSectors &= ~(1 << SECTOR_ID_SAVEBLOCK2);
+
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        if (!IsSectorUnchanged(slot, i, locations))
+        {
+            slot->cleanSectors &= ~(1 << i);
+            slot->counters[i] = gSaveCounter;
+        }
+    }
+    slot->firstSector = gLastWrittenSector;
+    slot->countersKnown = TRUE;
+}
 
 void ClearSaveData(void)
 {
     u16 i;
 
+    ResetSaveSlotStates();
+
     // Clear the full save two sectors at a time
     for (i = 0; i < SECTORS_COUNT / 2; i++)
     {
@@ -113,6 +237,7 @@ void Save_ResetSaveCounters(void)
     gSaveCounter = 0;
     gLastWrittenSector = 0;
     gDamagedSaveSectors = 0;
+    ResetSaveSlotStates();
 }
 
 static bool32 SetDamagedSectorBits(u8 op, u8 sectorId)
@@ -140,6 +265,7 @@ static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *l
 {
     u32 status;
     u16 i;
+    struct SaveSlotState *slot;
 
     gReadWriteSector = &gSaveDataBuffer;
 
@@ -154,18 +280,33 @@ static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *l
         // No sector was specified, write full save slot.
         gLastKnownGoodSector = gLastWrittenSector; // backup the current written sector before attempting to write.
         gLastSaveCounter = gSaveCounter;
-        gLastWrittenSector++;
-        gLastWrittenSector = gLastWrittenSector % NUM_SECTORS_PER_SLOT;
         gSaveCounter++;
+        slot = &sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS];
+        if (slot->countersKnown && (gSaveCounter / NUM_SAVE_SLOTS) % SLOT_WRITES_PER_ROTATION != 0)
+        {
+            // Keep the slot's layout, so the sectors that didn't change can be skipped
+            gLastWrittenSector = slot->firstSector;
+            SetSaveSlotDirtySectors(FALSE, locations);
+        }
+        else
+        {
+            gLastWrittenSector++;
+            gLastWrittenSector = gLastWrittenSector % NUM_SECTORS_PER_SLOT;
+            SetSaveSlotDirtySectors(TRUE, locations);
+        }
         status = SAVE_STATUS_OK;
 
         for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
-            HandleWriteSector(i, locations);
+        {
+            if (!(slot->cleanSectors & (1 << i)))
+                HandleWriteSector(i, locations);
+        }
 
         if (gDamagedSaveSectors)
         {
             // At least one sector save failed
             status = SAVE_STATUS_ERROR;
+            ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
             gLastWrittenSector = gLastKnownGoodSector;
             gSaveCounter = gLastSaveCounter;
         }
@@ -195,9 +336,7 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locat
         ((u8 *)gReadWriteSector)[i] = 0;
 
     // Set footer data
-    gReadWriteSector->id = sectorId;
-    gReadWriteSector->signature = SECTOR_SIGNATURE;
-    gReadWriteSector->counter = gSaveCounter;
+    SetSectorFooter(sectorId);
 
     // Copy current data to temp buffer for writing
     for (i = 0; i < size; i++)
@@ -205,7 +344,14 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locat
 
     gReadWriteSector->checksum = CalculateChecksum(data, size);
 
-    return TryWriteSector(sector, gReadWriteSector->data);
+    if (TryWriteSector(sector, gReadWriteSector->data) != SAVE_STATUS_OK)
+    {
+        ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
+        return SAVE_STATUS_ERROR;
+    }
+
+    SetSectorWritten(sectorId, data, size, TRUE);
+    return SAVE_STATUS_OK;
 }
 
 static u8 HandleWriteSectorNBytes(u8 sectorId, u8 *data, u16 size)
@@ -253,6 +399,8 @@ static u32 RestoreSaveBackupVarsAndIncrement(const struct SaveSectorLocation *lo
     gSaveCounter++;
     gIncrementalSectorId = 0;
     gDamagedSaveSectors = 0;
+    gSaveSectorsWritten = 0;
+    SetSaveSlotDirtySectors(TRUE, locations);
     return 0;
 }
 
@@ -263,6 +411,7 @@ static u32 RestoreSaveBackupVars(const struct SaveSectorLocation *locations)
     gLastSaveCounter = gSaveCounter;
     gIncrementalSectorId = 0;
     gDamagedSaveSectors = 0;
+    gSaveSectorsWritten = 0;
     return 0;
 }
 
@@ -329,9 +478,7 @@ static u8 HandleReplaceSector(u16 sectorId, const struct SaveSectorLocation *loc
         ((u8 *)gReadWriteSector)[i] = 0;
 
     // Set footer data
-    gReadWriteSector->id = sectorId;
-    gReadWriteSector->signature = SECTOR_SIGNATURE;
-    gReadWriteSector->counter = gSaveCounter;
+    SetSectorFooter(sectorId);
 
     // Copy current data to temp buffer for writing
     for (i = 0; i < size; i++)
@@ -358,6 +505,7 @@ static u8 HandleReplaceSector(u16 sectorId, const struct SaveSectorLocation *loc
     {
         // Writing save data failed
         SetDamagedSectorBits(ENABLE, sector);
+        ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
         return SAVE_STATUS_ERROR;
     }
     else
@@ -380,12 +528,14 @@ static u8 HandleReplaceSector(u16 sectorId, const struct SaveSectorLocation *loc
         {
             // Writing signature/counter failed
             SetDamagedSectorBits(ENABLE, sector);
+            ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
             return SAVE_STATUS_ERROR;
         }
         else
         {
             // Succeeded
             SetDamagedSectorBits(DISABLE, sector);
+            SetSectorWritten(sectorId, data, size, FALSE);
             return SAVE_STATUS_OK;
         }
     }
@@ -404,6 +554,7 @@ static u8 WriteSectorSignatureByte_NoOffset(u16 sectorId, const struct SaveSecto
     {
         // Sector is damaged, so enable the bit in gDamagedSaveSectors and restore the last written sector and save counter.
         SetDamagedSectorBits(ENABLE, sector);
+        ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
         gLastWrittenSector = gLastKnownGoodSector;
         gSaveCounter = gLastSaveCounter;
         return SAVE_STATUS_ERROR;
@@ -412,6 +563,7 @@ static u8 WriteSectorSignatureByte_NoOffset(u16 sectorId, const struct SaveSecto
     {
         // Succeeded
         SetDamagedSectorBits(DISABLE, sector);
+        SetSectorSignatureWritten(sectorId);
         return SAVE_STATUS_OK;
     }
 }
@@ -428,6 +580,7 @@ static u8 CopySectorSignatureByte(u16 sectorId, const struct SaveSectorLocation
     {
         // Sector is damaged, so enable the bit in gDamagedSaveSectors and restore the last written sector and save counter.
         SetDamagedSectorBits(ENABLE, sector);
+        ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
         gLastWrittenSector = gLastKnownGoodSector;
         gSaveCounter = gLastSaveCounter;
         return SAVE_STATUS_ERROR;
@@ -436,6 +589,7 @@ static u8 CopySectorSignatureByte(u16 sectorId, const struct SaveSectorLocation
     {
         // Succeeded
         SetDamagedSectorBits(DISABLE, sector);
+        SetSectorSignatureWritten(sectorId - 1);
         return SAVE_STATUS_OK;
     }
 }
@@ -452,6 +606,7 @@ static u8 WriteSectorSignatureByte(u16 sectorId, const struct SaveSectorLocation
     {
         // Sector is damaged, so enable the bit in gDamagedSaveSectors and restore the last written sector and save counter.
         SetDamagedSectorBits(ENABLE, sector);
+        ResetSaveSlotState(gSaveCounter % NUM_SAVE_SLOTS);
         gLastWrittenSector = gLastKnownGoodSector;
         gSaveCounter = gLastSaveCounter;
         return SAVE_STATUS_ERROR;
@@ -460,6 +615,7 @@ static u8 WriteSectorSignatureByte(u16 sectorId, const struct SaveSectorLocation
     {
         // Succeeded
         SetDamagedSectorBits(DISABLE, sector);
+        SetSectorSignatureWritten(sectorId - 1);
         return SAVE_STATUS_OK;
     }
 }
@@ -476,6 +632,7 @@ static u8 TryLoadSaveSlot(u16 sectorId, struct SaveSectorLocation *locations)
     else
     {
         status = GetSaveValidStatus(locations);
+        ResetSaveSlotStates();
         CopySaveSlotData(FULL_SAVE_SLOT, locations);
     }
 
@@ -489,6 +646,7 @@ static u8 CopySaveSlotData(u16 sectorId, struct SaveSectorLocation *locations)
     u16 checksum;
     u16 slotOffset = NUM_SECTORS_PER_SLOT * (gSaveCounter % NUM_SAVE_SLOTS);
     u16 id;
+    struct SaveSlotState *slot = &sSaveSlotStates[gSaveCounter % NUM_SAVE_SLOTS];
 
     for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
     {
@@ -506,12 +664,44 @@ static u8 CopySaveSlotData(u16 sectorId, struct SaveSectorLocation *locations)
             u16 j;
             for (j = 0; j < locations[id].size; j++)
                 ((u8 *)locations[id].data)[j] = gReadWriteSector->data[j];
+
+            // Remember what the slot holds, so the next save to it can skip unchanged sectors
+            if (id < NUM_SECTORS_PER_SLOT)
+            {
+                slot->counters[id] = gReadWriteSector->counter;
+                slot->checksums[id] = checksum;
+                slot->hashes[id] = CalculateSectorHash(gReadWriteSector->data, locations[id].size);
+                slot->cleanSectors |= 1 << id;
+            }
         }
     }
 
+    slot->firstSector = gLastWrittenSector;
+    slot->countersKnown = (slot->cleanSectors == (1 << NUM_SECTORS_PER_SLOT) - 1);
     return SAVE_STATUS_OK;
 }
 
+// Checks that every sector of a save slot belongs to the save that wrote its SaveBlock2 sector.
+static bool32 IsSaveSlotComplete(const u32 *sectorCounters, const struct SaveSlotManifest *manifest)
+{
+    u16 i;
+
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        if (manifest->signature == SAVE_MANIFEST_SIGNATURE)
+        {
+            if (sectorCounters[i] != manifest->sectorCounters[i])
+                return FALSE;
+        }
+        else if (sectorCounters[i] != sectorCounters[SECTOR_ID_SAVEBLOCK2])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
 static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
 {
     u16 i;
@@ -522,6 +712,8 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
     bool8 signatureValid = FALSE;
     u8 saveSlot1Status;
     u8 saveSlot2Status;
+    u32 sectorCounters[NUM_SECTORS_PER_SLOT] = {0};
+    struct SaveSlotManifest manifest = {0};
 
     // Check save slot 1
     for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
@@ -531,9 +723,11 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
         {
             signatureValid = TRUE;
             checksum = CalculateChecksum(gReadWriteSector->data, locations[gReadWriteSector->id].size);
-            if (gReadWriteSector->checksum == checksum)
+            if (gReadWriteSector->checksum == checksum && gReadWriteSector->id < NUM_SECTORS_PER_SLOT)
             {
-                saveSlot1Counter = gReadWriteSector->counter;
+                sectorCounters[gReadWriteSector->id] = gReadWriteSector->counter;
+                if (gReadWriteSector->id == SECTOR_ID_SAVEBLOCK2)
+                    manifest = gReadWriteSector->manifest;
                 validSectorFlags |= 1 << gReadWriteSector->id;
             }
         }
@@ -541,7 +735,8 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
 
     if (signatureValid)
     {
-        if (validSectorFlags == (1 << NUM_SECTORS_PER_SLOT) - 1)
+        saveSlot1Counter = sectorCounters[SECTOR_ID_SAVEBLOCK2];
+        if (validSectorFlags == (1 << NUM_SECTORS_PER_SLOT) - 1 && IsSaveSlotComplete(sectorCounters, &manifest))
             saveSlot1Status = SAVE_STATUS_OK;
         else
             saveSlot1Status = SAVE_STATUS_ERROR;
@@ -554,6 +749,7 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
 
     validSectorFlags = 0;
     signatureValid = FALSE;
+    manifest.signature = 0;
 
     // Check save slot 2
     for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
@@ -563,9 +759,11 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
         {
             signatureValid = TRUE;
             checksum = CalculateChecksum(gReadWriteSector->data, locations[gReadWriteSector->id].size);
-            if (gReadWriteSector->checksum == checksum)
+            if (gReadWriteSector->checksum == checksum && gReadWriteSector->id < NUM_SECTORS_PER_SLOT)
             {
-                saveSlot2Counter = gReadWriteSector->counter;
+                sectorCounters[gReadWriteSector->id] = gReadWriteSector->counter;
+                if (gReadWriteSector->id == SECTOR_ID_SAVEBLOCK2)
+                    manifest = gReadWriteSector->manifest;
                 validSectorFlags |= 1 << gReadWriteSector->id;
             }
         }
@@ -573,7 +771,8 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
 
     if (signatureValid)
     {
-        if (validSectorFlags == (1 << NUM_SECTORS_PER_SLOT) - 1)
+        saveSlot2Counter = sectorCounters[SECTOR_ID_SAVEBLOCK2];
+        if (validSectorFlags == (1 << NUM_SECTORS_PER_SLOT) - 1 && IsSaveSlotComplete(sectorCounters, &manifest))
             saveSlot2Status = SAVE_STATUS_OK;
         else
             saveSlot2Status = SAVE_STATUS_ERROR;
@@ -686,6 +885,21 @@ static u16 CalculateChecksum(void *data, u16 size)
     return ((checksum >> 16) + checksum);
 }
 
+// Stronger than the checksum, only used to tell whether a sector's data changed
+static u32 CalculateSectorHash(void *data, u16 size)
+{
+    u16 i;
+    u32 hash = 2166136261;
+
+    for (i = 0; i < (size / 4); i++)
+    {
+        hash = (hash ^ *((u32 *)data)) * 16777619;
+        data += sizeof(u32);
+    }
+
+    return hash;
+}
+
 static void UpdateSaveAddresses(void)
 {
     int i = SECTOR_ID_SAVEBLOCK2;
@@ -712,6 +926,7 @@ u8 HandleSavingData(u8 saveType)
     u8 *tempAddr;
 
     gTrainerHillVBlankCounter = NULL;
+    gSaveSectorsWritten = 0;
     UpdateSaveAddresses();
     switch (saveType)
     {
@@ -885,6 +1100,8 @@ u8 LoadGameSave(u8 saveType)
     case SAVE_NORMAL:
     default:
         status = TryLoadSaveSlot(FULL_SAVE_SLOT, gRamSaveSectorLocations);
+        InvalidateItemSlotIndex();
+        ResetBoxMonSummaries();
         CopyPartyAndObjectsFromSave();
         gSaveFileStatus = status;
         gGameContinueCallback = 0;
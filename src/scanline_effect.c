@@ -1,12 +1,19 @@
 #include "global.h"
 #include "battle.h"
 #include "data.h"
+#include "gpu_regs.h"
+#include "main.h"
 #include "task.h"
 #include "trig.h"
 #include "scanline_effect.h"
 
+// Longest wave (frequency 1) plus a screen's worth of lines, so the DMA can
+// read a whole frame starting at any phase of the wave.
+#define WAVE_STRIP_LENGTH (256 + DISPLAY_HEIGHT)
+
 static void CopyValue16Bit(void);
 static void CopyValue32Bit(void);
+static void StopIrqChannels(void);
 
 // EWRAM vars
 
@@ -15,13 +22,28 @@ static void CopyValue32Bit(void);
 // without overwriting the buffer that the DMA is currently reading
 EWRAM_DATA u16 gScanlineEffectRegBuffers[2][0x3C0] = {0};
 
+// Per-scanline values for the registers written by the HBlank interrupt,
+// double buffered the same way as gScanlineEffectRegBuffers.
+EWRAM_DATA u16 gScanlineEffectIrqBuffers[2][SCANLINE_EFFECT_MAX_IRQ_CHANNELS][DISPLAY_HEIGHT] = {0};
+
 EWRAM_DATA struct ScanlineEffect gScanlineEffect = {0};
+EWRAM_DATA struct ScanlineEffectStats gScanlineEffectStats = {0};
 EWRAM_DATA static bool8 sShouldStopWaveTask = FALSE;
 
+// Wave values with the task's offset already added, repeated so that a whole
+// frame can be read from any starting phase. One per DMA buffer.
+EWRAM_DATA static u16 sWaveStrips[2][WAVE_STRIP_LENGTH] = {0};
+
+static vu16 *sIrqChannelRegs[SCANLINE_EFFECT_MAX_IRQ_CHANNELS];
+static u8 sIrqChannelCount;
+static u8 sIrqDisplayBuffer;
+static u16 sCpuLines;
+
 void ScanlineEffect_Stop(void)
 {
     gScanlineEffect.state = 0;
     DmaStop(0);
+    StopIrqChannels();
     if (gScanlineEffect.waveTaskId != TASK_NONE)
     {
         DestroyTask(gScanlineEffect.waveTaskId);
@@ -38,39 +60,60 @@ void ScanlineEffect_Clear(void)
     gScanlineEffect.dmaControl = 0;
     gScanlineEffect.srcBuffer = 0;
     gScanlineEffect.state = 0;
-    gScanlineEffect.unused16 = 0;
+    gScanlineEffect.unitsPerLine = 0;
     gScanlineEffect.unused17 = 0;
     gScanlineEffect.waveTaskId = TASK_NONE;
+    StopIrqChannels();
+    CpuFill16(0, gScanlineEffectIrqBuffers, sizeof(gScanlineEffectIrqBuffers));
+    CpuFill16(0, &gScanlineEffectStats, sizeof(gScanlineEffectStats));
+    sCpuLines = 0;
 }
 
 void ScanlineEffect_SetParams(struct ScanlineEffectParams params)
 {
-    if (params.dmaControl == SCANLINE_EFFECT_DMACNT_16BIT)  // 16-bit
+    u8 unitsPerLine = params.dmaControl & 0xFFFF;
+
+    if (unitsPerLine == 0)
+        unitsPerLine = 1;
+
+    if (!(params.dmaControl & (DMA_32BIT << 16)))  // 16-bit
     {
         // Set the DMA src to the value for the second scanline because the
         // first DMA transfer occurs in HBlank *after* the first scanline is drawn
-        gScanlineEffect.dmaSrcBuffers[0] = (u16 *)gScanlineEffectRegBuffers[0] + 1;
-        gScanlineEffect.dmaSrcBuffers[1] = (u16 *)gScanlineEffectRegBuffers[1] + 1;
+        gScanlineEffect.dmaSrcBuffers[0] = (u16 *)gScanlineEffectRegBuffers[0] + unitsPerLine;
+        gScanlineEffect.dmaSrcBuffers[1] = (u16 *)gScanlineEffectRegBuffers[1] + unitsPerLine;
         gScanlineEffect.setFirstScanlineReg = CopyValue16Bit;
     }
-    else  // assume 32-bit
+    else  // 32-bit
     {
         // Set the DMA src to the value for the second scanline because the
         // first DMA transfer occurs in HBlank *after* the first scanline is drawn
-        gScanlineEffect.dmaSrcBuffers[0] = (u32 *)gScanlineEffectRegBuffers[0] + 1;
-        gScanlineEffect.dmaSrcBuffers[1] = (u32 *)gScanlineEffectRegBuffers[1] + 1;
+        gScanlineEffect.dmaSrcBuffers[0] = (u32 *)gScanlineEffectRegBuffers[0] + unitsPerLine;
+        gScanlineEffect.dmaSrcBuffers[1] = (u32 *)gScanlineEffectRegBuffers[1] + unitsPerLine;
         gScanlineEffect.setFirstScanlineReg = CopyValue32Bit;
     }
 
-    gScanlineEffect.dmaControl = params.dmaControl;
-    gScanlineEffect.dmaDest    = params.dmaDest;
-    gScanlineEffect.state      = params.initState;
-    gScanlineEffect.unused16   = params.unused9;
-    gScanlineEffect.unused17   = params.unused9;
+    gScanlineEffect.dmaControl   = params.dmaControl;
+    gScanlineEffect.dmaDest      = params.dmaDest;
+    gScanlineEffect.state        = params.initState;
+    gScanlineEffect.unitsPerLine = unitsPerLine;
+    gScanlineEffect.unused17     = params.unused9;
+}
+
+// Publishes the work done for the frame that is about to be displayed.
+static void UpdateStats(void)
+{
+    gScanlineEffectStats.dmaUnits = gScanlineEffect.dmaControl != 0 ? gScanlineEffect.unitsPerLine * DISPLAY_HEIGHT : 0;
+    gScanlineEffectStats.irqWrites = sIrqChannelCount * DISPLAY_HEIGHT;
+    gScanlineEffectStats.cpuLines = sCpuLines;
+    gScanlineEffectStats.irqChannels = sIrqChannelCount;
+    sCpuLines = 0;
 }
 
 void ScanlineEffect_InitHBlankDmaTransfer(void)
 {
+    int i;
+
     if (gScanlineEffect.state == 0)
     {
         return;
@@ -79,39 +122,111 @@ void ScanlineEffect_InitHBlankDmaTransfer(void)
     {
         gScanlineEffect.state = 0;
         DmaStop(0);
+        StopIrqChannels();
         sShouldStopWaveTask = TRUE;
     }
     else
     {
-        DmaStop(0);
-        // Set DMA to copy to dest register on each HBlank for the next frame.
-        // The HBlank DMA transfers do not occurr during VBlank, so the transfer
-        // will begin on the HBlank after the first scanline
-        DmaSet(0, gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer], gScanlineEffect.dmaDest, gScanlineEffect.dmaControl);
-        // Manually set the reg for the first scanline
-        gScanlineEffect.setFirstScanlineReg();
+        if (gScanlineEffect.dmaControl != 0)
+        {
+            DmaStop(0);
+            // Set DMA to copy to dest register on each HBlank for the next frame.
+            // The HBlank DMA transfers do not occurr during VBlank, so the transfer
+            // will begin on the HBlank after the first scanline
+            DmaSet(0, gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer], gScanlineEffect.dmaDest, gScanlineEffect.dmaControl);
+            // Manually set the reg for the first scanline
+            gScanlineEffect.setFirstScanlineReg();
+        }
+
+        // The HBlank interrupt handles the rest of the lines the same way
+        sIrqDisplayBuffer = gScanlineEffect.srcBuffer;
+        for (i = 0; i < sIrqChannelCount; i++)
+            *sIrqChannelRegs[i] = gScanlineEffectIrqBuffers[sIrqDisplayBuffer][i][0];
+
+        UpdateStats();
         // Swap current buffer
         gScanlineEffect.srcBuffer ^= 1;
     }
 }
 
-// These two functions are used to copy the register for the first scanline,
-// depending whether it is a 16-bit register or a 32-bit register.
+// These two functions are used to copy the registers for the first scanline,
+// depending whether they are 16-bit registers or 32-bit registers. The values
+// for it sit just before where the DMA starts reading.
 
 static void CopyValue16Bit(void)
 {
     vu16 *dest = (vu16 *)gScanlineEffect.dmaDest;
-    vu16 *src = (vu16 *)&gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer];
+    u16 *src = (u16 *)gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer] - gScanlineEffect.unitsPerLine;
+    int i;
 
-    *dest = *src;
+    for (i = 0; i < gScanlineEffect.unitsPerLine; i++)
+        dest[i] = src[i];
 }
 
 static void CopyValue32Bit(void)
 {
     vu32 *dest = (vu32 *)gScanlineEffect.dmaDest;
-    vu32 *src = (vu32 *)&gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer];
+    u32 *src = (u32 *)gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer] - gScanlineEffect.unitsPerLine;
+    int i;
+
+    for (i = 0; i < gScanlineEffect.unitsPerLine; i++)
+        dest[i] = src[i];
+}
+
+// Adds a 16-bit register to be written on every scanline from the HBlank
+// interrupt, for registers the DMA can't also cover because they aren't next
+// to its destination. Values are written to gScanlineEffectIrqBuffers, in the
+// buffer given by gScanlineEffect.srcBuffer, the same as the DMA's buffers.
+// Returns the channel index, or 0xFF if all channels are in use.
+u8 ScanlineEffect_AddIrqChannel(volatile void *reg)
+{
+    u8 channel;
+
+    if (sIrqChannelCount >= SCANLINE_EFFECT_MAX_IRQ_CHANNELS)
+        return 0xFF;
+
+    channel = sIrqChannelCount;
+    sIrqChannelRegs[channel] = reg;
+    sIrqChannelCount++;
+    if (channel == 0)
+    {
+        SetHBlankCallback(ScanlineEffect_HBlankCallback);
+        EnableInterrupts(INTR_FLAG_HBLANK);
+    }
+    return channel;
+}
+
+static void StopIrqChannels(void)
+{
+    if (sIrqChannelCount == 0)
+        return;
+
+    sIrqChannelCount = 0;
+    if (gMain.hblankCallback == ScanlineEffect_HBlankCallback)
+    {
+        DisableInterrupts(INTR_FLAG_HBLANK);
+        SetHBlankCallback(NULL);
+    }
+}
+
+// Can also be called from a screen's own HBlank callback to chain the channels.
+void ScanlineEffect_HBlankCallback(void)
+{
+    u32 line = REG_VCOUNT + 1;
+    u32 i;
+
+    // The first line is set during VBlank
+    if (line >= DISPLAY_HEIGHT)
+        return;
 
-    *dest = *src;
+    for (i = 0; i < sIrqChannelCount; i++)
+        *sIrqChannelRegs[i] = gScanlineEffectIrqBuffers[sIrqDisplayBuffer][i][line];
+}
+
+// For effects that rewrite the buffers themselves, to be counted in gScanlineEffectStats.
+void ScanlineEffect_AddCpuLines(u16 count)
+{
+    sCpuLines += count;
 }
 
 #define tStartLine            data[0]
@@ -122,75 +237,94 @@ static void CopyValue32Bit(void)
 #define tDelayInterval        data[5]
 #define tRegOffset            data[6]
 #define tApplyBattleBgOffsets data[7]
+#define tStripValue(i)        data[8 + (i)]
+
+static u16 GetBattleBgOffset(u8 regOffset)
+{
+    switch (regOffset)
+    {
+    case SCANLINE_EFFECT_REG_BG0HOFS:
+        return gBattle_BG0_X;
+    case SCANLINE_EFFECT_REG_BG0VOFS:
+        return gBattle_BG0_Y;
+    case SCANLINE_EFFECT_REG_BG1HOFS:
+        return gBattle_BG1_X;
+    case SCANLINE_EFFECT_REG_BG1VOFS:
+        return gBattle_BG1_Y;
+    case SCANLINE_EFFECT_REG_BG2HOFS:
+        return gBattle_BG2_X;
+    case SCANLINE_EFFECT_REG_BG2VOFS:
+        return gBattle_BG2_Y;
+    case SCANLINE_EFFECT_REG_BG3HOFS:
+        return gBattle_BG3_X;
+    case SCANLINE_EFFECT_REG_BG3VOFS:
+        return gBattle_BG3_Y;
+    }
+    return 0;
+}
+
+// Fills a strip with the wave generated in gScanlineEffectRegBuffers[0][320],
+// plus the given offset. Lines past the 256 generated values are 0, as they
+// were when the wave was read straight out of the (cleared) buffer; only
+// frequency 1 waves reach them.
+static void BuildWaveStrip(u16 *strip, u16 waveLength, u16 value)
+{
+    const u16 *wave = &gScanlineEffectRegBuffers[0][320];
+    u16 i;
 
+    for (i = 0; i < waveLength + DISPLAY_HEIGHT; i++)
+        strip[i] = (i < 256 ? wave[i] : 0) + value;
+    sCpuLines += waveLength + DISPLAY_HEIGHT;
+}
+
+// Moving the wave only changes where in the strip the frame starts reading.
+// A wave covering the whole screen has the DMA read the strip directly;
+// otherwise its lines are block copied into the DMA buffer. Strips are only
+// rebuilt when the battle BG offset changes.
 static void TaskFunc_UpdateWavePerFrame(u8 taskId)
 {
-    int value = 0;
-    int i;
-    int offset;
+    struct Task *task = &gTasks[taskId];
+    u8 buffer = gScanlineEffect.srcBuffer;
+    u16 *strip = sWaveStrips[buffer];
+    u16 value = 0;
 
     if (sShouldStopWaveTask)
     {
         DestroyTask(taskId);
         gScanlineEffect.waveTaskId = TASK_NONE;
+        return;
+    }
+
+    if (task->tApplyBattleBgOffsets)
+        value = GetBattleBgOffset(task->tRegOffset);
+    if ((u16)task->tStripValue(buffer) != value)
+    {
+        BuildWaveStrip(strip, task->tWaveLength, value);
+        task->tStripValue(buffer) = value;
+    }
+
+    if (task->tStartLine == 0 && task->tEndLine == DISPLAY_HEIGHT)
+    {
+        gScanlineEffect.dmaSrcBuffers[buffer] = &strip[task->tSrcBufferOffset + 1];
     }
     else
     {
-        if (gTasks[taskId].tApplyBattleBgOffsets)
-        {
-            switch (gTasks[taskId].tRegOffset)
-            {
-            case SCANLINE_EFFECT_REG_BG0HOFS:
-                value = gBattle_BG0_X;
-                break;
-            case SCANLINE_EFFECT_REG_BG0VOFS:
-                value = gBattle_BG0_Y;
-                break;
-            case SCANLINE_EFFECT_REG_BG1HOFS:
-                value = gBattle_BG1_X;
-                break;
-            case SCANLINE_EFFECT_REG_BG1VOFS:
-                value = gBattle_BG1_Y;
-                break;
-            case SCANLINE_EFFECT_REG_BG2HOFS:
-                value = gBattle_BG2_X;
-                break;
-            case SCANLINE_EFFECT_REG_BG2VOFS:
-                value = gBattle_BG2_Y;
-                break;
-            case SCANLINE_EFFECT_REG_BG3HOFS:
-                value = gBattle_BG3_X;
-                break;
-            case SCANLINE_EFFECT_REG_BG3VOFS:
-                value = gBattle_BG3_Y;
-                break;
-            }
-        }
-        if (gTasks[taskId].tFramesUntilMove != 0)
-        {
-            gTasks[taskId].tFramesUntilMove--;
-            offset = gTasks[taskId].tSrcBufferOffset + 320;
-            for (i = gTasks[taskId].tStartLine; i < gTasks[taskId].tEndLine; i++)
-            {
-                gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer][i] = gScanlineEffectRegBuffers[0][offset] + value;
-                offset++;
-            }
-        }
-        else
-        {
-            gTasks[taskId].tFramesUntilMove = gTasks[taskId].tDelayInterval;
-            offset = gTasks[taskId].tSrcBufferOffset + 320;
-            for (i = gTasks[taskId].tStartLine; i < gTasks[taskId].tEndLine; i++)
-            {
-                gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer][i] = gScanlineEffectRegBuffers[0][offset] + value;
-                offset++;
-            }
-
-            // increment src buffer offset
-            gTasks[taskId].tSrcBufferOffset++;
-            if (gTasks[taskId].tSrcBufferOffset == gTasks[taskId].tWaveLength)
-                gTasks[taskId].tSrcBufferOffset = 0;
-        }
+        CpuCopy16(&strip[task->tSrcBufferOffset], &gScanlineEffectRegBuffers[buffer][task->tStartLine], (task->tEndLine - task->tStartLine) * sizeof(u16));
+        sCpuLines += task->tEndLine - task->tStartLine;
+    }
+
+    if (task->tFramesUntilMove != 0)
+    {
+        task->tFramesUntilMove--;
+    }
+    else
+    {
+        task->tFramesUntilMove = task->tDelayInterval;
+
+        // increment src buffer offset
+        task->tSrcBufferOffset++;
+        if (task->tSrcBufferOffset == task->tWaveLength)
+            task->tSrcBufferOffset = 0;
     }
 }
 
@@ -242,6 +376,12 @@ u8 ScanlineEffect_InitWave(u8 startLine, u8 endLine, u8 frequency, u8 amplitude,
 
     GenerateWave(&gScanlineEffectRegBuffers[0][320], frequency, amplitude, endLine - startLine);
 
+    for (i = 0; i < 2; i++)
+    {
+        BuildWaveStrip(sWaveStrips[i], gTasks[taskId].tWaveLength, 0);
+        gTasks[taskId].tStripValue(i) = 0;
+    }
+
     offset = 320;
     for (i = startLine; i < endLine; i++)
     {
@@ -27,6 +27,14 @@ static struct ScriptContext sGlobalScriptContext;
 static struct ScriptContext sImmediateScriptContext;
 static bool8 sLockFieldControls;
 
+// The current map's ON_FRAME table is only checked again once a var it compares may have changed.
+// Special vars are written to directly all over the place, so tables comparing them are always checked.
+static const u8 *sOnFrameMapScripts;
+static u8 *sOnFrameScriptTable;
+static u32 sOnFrameScriptVars[(VARS_COUNT + 31) / 32];
+static bool8 sOnFrameScriptTableHasSpecialVars;
+static bool8 sCheckOnFrameScriptTable;
+
 extern ScrCmdFunc gScriptCmdTable[];
 extern ScrCmdFunc gScriptCmdTableEnd[];
 extern void *gNullScriptPtr;
@@ -211,6 +219,7 @@ void ScriptContext_Init(void)
 {
     InitScriptContext(&sGlobalScriptContext, gScriptCmdTable, gScriptCmdTableEnd);
     sGlobalScriptContextStatus = CONTEXT_SHUTDOWN;
+    RequestOnFrameMapScriptCheck();
 }
 
 // Runs the script until the script makes a wait* call, then returns true if
@@ -231,6 +240,7 @@ bool8 ScriptContext_RunScript(void)
     {
         sGlobalScriptContextStatus = CONTEXT_SHUTDOWN;
         UnlockPlayerFieldControls();
+        RequestOnFrameMapScriptCheck();
         return FALSE;
     }
 
@@ -267,6 +277,7 @@ void RunScriptImmediately(const u8 *ptr)
     InitScriptContext(&sImmediateScriptContext, gScriptCmdTable, gScriptCmdTableEnd);
     SetupBytecodeScript(&sImmediateScriptContext, ptr);
     while (RunScriptCommand(&sImmediateScriptContext) == TRUE);
+    RequestOnFrameMapScriptCheck();
 }
 
 u8 *MapHeaderGetScriptTable(u8 tag)
@@ -296,10 +307,8 @@ void MapHeaderRunScriptType(u8 tag)
         RunScriptImmediately(ptr);
 }
 
-u8 *MapHeaderCheckScriptTable(u8 tag)
+static u8 *CheckScriptTable(u8 *ptr)
 {
-    u8 *ptr = MapHeaderGetScriptTable(tag);
-
     if (!ptr)
         return NULL;
 
@@ -325,6 +334,62 @@ u8 *MapHeaderCheckScriptTable(u8 tag)
     }
 }
 
+u8 *MapHeaderCheckScriptTable(u8 tag)
+{
+    return CheckScriptTable(MapHeaderGetScriptTable(tag));
+}
+
+static void WatchOnFrameScriptVar(u16 varIndex)
+{
+    // Values below VARS_START are constants
+    if (varIndex < VARS_START)
+        return;
+
+    if (varIndex > VARS_END)
+        sOnFrameScriptTableHasSpecialVars = TRUE;
+    else
+        sOnFrameScriptVars[(varIndex - VARS_START) / 32] |= 1 << ((varIndex - VARS_START) % 32);
+}
+
+static void LoadOnFrameScriptTable(void)
+{
+    u8 *ptr;
+
+    sOnFrameMapScripts = gMapHeader.mapScripts;
+    sOnFrameScriptTable = MapHeaderGetScriptTable(MAP_SCRIPT_ON_FRAME_TABLE);
+    sOnFrameScriptTableHasSpecialVars = FALSE;
+    sCheckOnFrameScriptTable = TRUE;
+    memset(sOnFrameScriptVars, 0, sizeof(sOnFrameScriptVars));
+
+    ptr = sOnFrameScriptTable;
+    if (!ptr)
+        return;
+
+    while (T1_READ_16(ptr))
+    {
+        WatchOnFrameScriptVar(T1_READ_16(ptr));
+        WatchOnFrameScriptVar(T1_READ_16(ptr + 2));
+        ptr += 8;
+    }
+}
+
+// Called whenever a var may have been written to
+void SetOnFrameMapScriptVarChanged(u16 varIndex)
+{
+    if (varIndex < VARS_START)
+        return;
+
+    if (varIndex > VARS_END
+     || sOnFrameScriptVars[(varIndex - VARS_START) / 32] & (1 << ((varIndex - VARS_START) % 32)))
+        sCheckOnFrameScriptTable = TRUE;
+}
+
+// Called when any number of vars may have been written to, e.g. by a script or when returning to the field
+void RequestOnFrameMapScriptCheck(void)
+{
+    sCheckOnFrameScriptTable = TRUE;
+}
+
 void RunOnLoadMapScript(void)
 {
     MapHeaderRunScriptType(MAP_SCRIPT_ON_LOAD);
@@ -352,7 +417,17 @@ void RunOnDiveWarpMapScript(void)
 
 bool8 TryRunOnFrameMapScript(void)
 {
-    u8 *ptr = MapHeaderCheckScriptTable(MAP_SCRIPT_ON_FRAME_TABLE);
+    u8 *ptr;
+
+    if (gMapHeader.mapScripts != sOnFrameMapScripts)
+        LoadOnFrameScriptTable();
+
+    if (!sCheckOnFrameScriptTable)
+        return FALSE;
+
+    ptr = CheckScriptTable(sOnFrameScriptTable);
+    if (!sOnFrameScriptTableHasSpecialVars)
+        sCheckOnFrameScriptTable = FALSE;
 
     if (!ptr)
         return FALSE;
@@ -13,7 +13,30 @@ static EWRAM_DATA struct {
     u16 size;
 } sTilesetDMA3TransferBuffer[20] = {0};
 
+// Every animated tile range that has been queued since the tilesets were
+// loaded, along with how many of the metatiles currently in the field camera's
+// 16x16 tilemap buffer use it. Uploads for ranges nobody can see are skipped;
+// the last frame that was skipped gets uploaded once the range is back in view.
+#define MAX_TILESET_ANIM_RANGES 32
+#define NUM_BUFFERED_METATILES  256
+
+struct TilesetAnimRange
+{
+    const u16 *lastSrc;
+    u16 *dest;
+    u16 size;
+    u16 numVisible;
+    bool8 needsResync;
+};
+
+static EWRAM_DATA struct TilesetAnimRange sTilesetAnimRanges[MAX_TILESET_ANIM_RANGES] = {0};
+// Bit n is set for every tile that belongs to sTilesetAnimRanges[n].
+static EWRAM_DATA u32 sTileAnimRangeBits[NUM_TILES_TOTAL] = {0};
+// The metatile drawn at each cell of the field camera's tilemap buffer.
+static EWRAM_DATA const u16 *sBufferedMetatileTiles[NUM_BUFFERED_METATILES] = {0};
+
 static u8 sTilesetDMA3TransferBufferSize;
+static u8 sNumTilesetAnimRanges;
 static u16 sPrimaryTilesetAnimCounter;
 static u16 sPrimaryTilesetAnimCounterMax;
 static u16 sSecondaryTilesetAnimCounter;
@@ -550,7 +573,7 @@ static void ResetTilesetAnimBuffer(void)
     CpuFill32(0, sTilesetDMA3TransferBuffer, sizeof sTilesetDMA3TransferBuffer);
 }
 
-static void AppendTilesetAnimToBuffer(const u16 *src, u16 *dest, u16 size)
+static bool8 QueueTilesetAnimTransfer(const u16 *src, u16 *dest, u16 size)
 {
     if (sTilesetDMA3TransferBufferSize < 20)
     {
@@ -558,6 +581,121 @@ static void AppendTilesetAnimToBuffer(const u16 *src, u16 *dest, u16 size)
         sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].dest = dest;
         sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].size = size;
         sTilesetDMA3TransferBufferSize ++;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static u32 GetMetatileAnimRanges(const u16 *tiles)
+{
+    u32 i, ranges = 0;
+
+    if (tiles == NULL)
+        return 0;
+
+    for (i = 0; i < NUM_TILES_PER_METATILE; i++)
+        ranges |= sTileAnimRangeBits[tiles[i] & 0x3FF];
+    return ranges;
+}
+
+static void ResetTilesetAnimRanges(void)
+{
+    sNumTilesetAnimRanges = 0;
+    CpuFill32(0, sTilesetAnimRanges, sizeof(sTilesetAnimRanges));
+    CpuFill32(0, sTileAnimRangeBits, sizeof(sTileAnimRangeBits));
+}
+
+// Returns the range written by a transfer to dest, registering it the first
+// time it's seen. Returns NULL if there's no room left to track it.
+static struct TilesetAnimRange *GetTilesetAnimRange(u16 *dest, u16 size)
+{
+    struct TilesetAnimRange *range;
+    u32 i, firstTile, numTiles, bit;
+
+    for (i = 0; i < sNumTilesetAnimRanges; i++)
+    {
+        if (sTilesetAnimRanges[i].dest == dest && sTilesetAnimRanges[i].size == size)
+            return &sTilesetAnimRanges[i];
+    }
+
+    if (sNumTilesetAnimRanges >= MAX_TILESET_ANIM_RANGES)
+        return NULL;
+
+    firstTile = ((u32)dest - BG_VRAM) / TILE_SIZE_4BPP;
+    numTiles = (size + TILE_SIZE_4BPP - 1) / TILE_SIZE_4BPP;
+    if (firstTile + numTiles > NUM_TILES_TOTAL)
+        return NULL;
+
+    bit = 1u << sNumTilesetAnimRanges;
+    range = &sTilesetAnimRanges[sNumTilesetAnimRanges++];
+    range->lastSrc = NULL;
+    range->dest = dest;
+    range->size = size;
+    range->numVisible = 0;
+    range->needsResync = FALSE;
+
+    for (i = 0; i < numTiles; i++)
+        sTileAnimRangeBits[firstTile + i] |= bit;
+    for (i = 0; i < NUM_BUFFERED_METATILES; i++)
+    {
+        if (GetMetatileAnimRanges(sBufferedMetatileTiles[i]) & bit)
+            range->numVisible++;
+    }
+    return range;
+}
+
+static void AppendTilesetAnimToBuffer(const u16 *src, u16 *dest, u16 size)
+{
+    struct TilesetAnimRange *range = GetTilesetAnimRange(dest, size);
+
+    if (range == NULL)
+    {
+        QueueTilesetAnimTransfer(src, dest, size);
+        return;
+    }
+
+    range->lastSrc = src;
+    if (range->numVisible != 0 && QueueTilesetAnimTransfer(src, dest, size))
+        range->needsResync = FALSE;
+    else
+        range->needsResync = TRUE;
+}
+
+// Catch up ranges whose tiles came into view after their uploads were skipped.
+static void ResyncTilesetAnimRanges(void)
+{
+    u32 i;
+
+    for (i = 0; i < sNumTilesetAnimRanges; i++)
+    {
+        struct TilesetAnimRange *range = &sTilesetAnimRanges[i];
+
+        if (range->needsResync && range->numVisible != 0
+         && QueueTilesetAnimTransfer(range->lastSrc, range->dest, range->size))
+            range->needsResync = FALSE;
+    }
+}
+
+// Called by the field camera whenever it draws a metatile into its tilemap
+// buffer, so the visible count of each animated tile range stays current.
+void TrackTilesetAnimMetatile(u16 offset, const u16 *tiles)
+{
+    u32 cell = ((offset >> 6) << 4) | ((offset & 0x1F) >> 1);
+    u32 oldRanges, newRanges, changed, i;
+
+    oldRanges = GetMetatileAnimRanges(sBufferedMetatileTiles[cell]);
+    newRanges = GetMetatileAnimRanges(tiles);
+    sBufferedMetatileTiles[cell] = tiles;
+
+    changed = oldRanges ^ newRanges;
+    for (i = 0; changed != 0; i++, changed >>= 1)
+    {
+        if (!(changed & 1))
+            continue;
+        if (newRanges & (1u << i))
+            sTilesetAnimRanges[i].numVisible++;
+        else
+            sTilesetAnimRanges[i].numVisible--;
     }
 }
 
@@ -574,18 +712,21 @@ void TransferTilesetAnimsBuffer(void)
 void InitTilesetAnimations(void)
 {
     ResetTilesetAnimBuffer();
+    ResetTilesetAnimRanges();
     _InitPrimaryTilesetAnimation();
     _InitSecondaryTilesetAnimation();
 }
 
 void InitSecondaryTilesetAnimation(void)
 {
+    ResetTilesetAnimRanges();
     _InitSecondaryTilesetAnimation();
 }
 
 void UpdateTilesetAnimations(void)
 {
     ResetTilesetAnimBuffer();
+    ResyncTilesetAnimRanges();
     if (++sPrimaryTilesetAnimCounter >= sPrimaryTilesetAnimCounterMax)
         sPrimaryTilesetAnimCounter = 0;
     if (++sSecondaryTilesetAnimCounter >= sSecondaryTilesetAnimCounterMax)
@@ -48,8 +48,6 @@ enum {
 #define WILD_CHECK_REPEL    (1 << 0)
 #define WILD_CHECK_KEEN_EYE (1 << 1)
 
-#define HEADER_NONE 0xFFFF
-
 static u16 FeebasRandom(void);
 static void FeebasSeedRng(u16 seed);
 static bool8 IsWildLevelAllowedByRepel(u8 level);
@@ -63,6 +61,10 @@ EWRAM_DATA static u8 sWildEncountersDisabled = 0;
 EWRAM_DATA static u32 sFeebasRngValue = 0;
 EWRAM_DATA bool8 gIsFishingEncounter = 0;
 EWRAM_DATA bool8 gIsSurfingEncounter = 0;
+EWRAM_DATA static u8 sWildMonHeaderMapGroup = 0;
+EWRAM_DATA static u8 sWildMonHeaderMapNum = 0;
+EWRAM_DATA static u16 sWildMonHeaderId = 0;
+EWRAM_DATA static bool8 sWildMonHeaderIdValid = FALSE;
 
 #include "data/wild_encounters.h"
 
@@ -136,7 +138,7 @@ static bool8 CheckFeebas(void)
             route119Section = 2;
 
         // 50% chance of encountering Feebas (assuming this is a Feebas spot)
-        if (Random() % 100 > 49)
+        if (RandomUniformOverworld(100) > 49)
             return FALSE;
 
         FeebasSeedRng(gSaveBlock1Ptr->dewfordTrends[0].rand);
@@ -180,39 +182,39 @@ static void FeebasSeedRng(u16 seed)
     sFeebasRngValue = seed;
 }
 
+// Running totals of the slot chances, for RandomWeightedOverworld
+static const u16 sLandMonsCumulativeChances[LAND_WILD_COUNT] =
+{
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_0,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_1,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_2,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_3,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_4,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_5,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_6,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_7,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_8,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_9,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_10,
+    ENCOUNTER_CHANCE_LAND_MONS_SLOT_11,
+};
+
+static const u16 sWaterMonsCumulativeChances[WATER_WILD_COUNT] =
+{
+    ENCOUNTER_CHANCE_WATER_MONS_SLOT_0,
+    ENCOUNTER_CHANCE_WATER_MONS_SLOT_1,
+    ENCOUNTER_CHANCE_WATER_MONS_SLOT_2,
+    ENCOUNTER_CHANCE_WATER_MONS_SLOT_3,
+    ENCOUNTER_CHANCE_WATER_MONS_SLOT_4,
+};
+
 // LAND_WILD_COUNT
 static u8 ChooseWildMonIndex_Land(void)
 {
-    u8 wildMonIndex = 0;
+    u8 wildMonIndex = RandomWeightedOverworld(sLandMonsCumulativeChances);
     bool8 swap = FALSE;
-    u8 rand = Random() % ENCOUNTER_CHANCE_LAND_MONS_TOTAL;
-
-    if (rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_0)
-        wildMonIndex = 0;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_0 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_1)
-        wildMonIndex = 1;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_1 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_2)
-        wildMonIndex = 2;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_2 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_3)
-        wildMonIndex = 3;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_3 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_4)
-        wildMonIndex = 4;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_4 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_5)
-        wildMonIndex = 5;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_5 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_6)
-        wildMonIndex = 6;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_6 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_7)
-        wildMonIndex = 7;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_7 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_8)
-        wildMonIndex = 8;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_8 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_9)
-        wildMonIndex = 9;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_9 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_10)
-        wildMonIndex = 10;
-    else
-        wildMonIndex = 11;
 
-    if (LURE_STEP_COUNT != 0 && (Random() % 10 < 2))
+    if (LURE_STEP_COUNT != 0 && (RandomUniformOverworld(10) < 2))
         swap = TRUE;
 
     if (swap)
@@ -224,22 +226,10 @@ static u8 ChooseWildMonIndex_Land(void)
 // ROCK_WILD_COUNT / WATER_WILD_COUNT
 static u8 ChooseWildMonIndex_WaterRock(void)
 {
-    u8 wildMonIndex = 0;
+    u8 wildMonIndex = RandomWeightedOverworld(sWaterMonsCumulativeChances);
     bool8 swap = FALSE;
-    u8 rand = Random() % ENCOUNTER_CHANCE_WATER_MONS_TOTAL;
-
-    if (rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_0)
-        wildMonIndex = 0;
-    else if (rand >= ENCOUNTER_CHANCE_WATER_MONS_SLOT_0 && rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_1)
-        wildMonIndex = 1;
-    else if (rand >= ENCOUNTER_CHANCE_WATER_MONS_SLOT_1 && rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_2)
-        wildMonIndex = 2;
-    else if (rand >= ENCOUNTER_CHANCE_WATER_MONS_SLOT_2 && rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_3)
-        wildMonIndex = 3;
-    else
-        wildMonIndex = 4;
 
-    if (LURE_STEP_COUNT != 0 && (Random() % 10 < 2))
+    if (LURE_STEP_COUNT != 0 && (RandomUniformOverworld(10) < 2))
         swap = TRUE;
 
     if (swap)
@@ -253,10 +243,10 @@ static u8 ChooseWildMonIndex_Fishing(u8 rod)
 {
     u8 wildMonIndex = 0;
     bool8 swap = FALSE;
-    u8 rand = Random() % max(max(ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_TOTAL, ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_TOTAL),
-                             ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_TOTAL);
+    u8 rand = RandomUniformOverworld(max(max(ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_TOTAL, ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_TOTAL),
+                                                   ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_TOTAL));
 
-    if (LURE_STEP_COUNT != 0 && (Random() % 10 < 2))
+    if (LURE_STEP_COUNT != 0 && (RandomUniformOverworld(10) < 2))
         swap = TRUE;
 
     switch (rod)
@@ -321,7 +311,7 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon, u8 wildMonIn
             max = wildPokemon[wildMonIndex].minLevel;
         }
         range = max - min + 1;
-        rand = Random() % range;
+        rand = RandomUniformOverworld(range);
 
         // check ability for max level mon
         if (!GetMonData(&gPlayerParty[0], MON_DATA_SANITY_IS_EGG))
@@ -329,7 +319,7 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon, u8 wildMonIn
             u16 ability = GetMonAbility(&gPlayerParty[0]);
             if (ability == ABILITY_HUSTLE || ability == ABILITY_VITAL_SPIRIT || ability == ABILITY_PRESSURE)
             {
-                if (Random() % 2 == 0)
+                if (RandomUniformOverworld(2) == 0)
                     return max;
 
                 if (rand != 0)
@@ -353,30 +343,32 @@ static u16 GetCurrentMapWildMonHeaderId(void)
 {
     u16 i;
 
-    for (i = 0; ; i++)
+    // The header only changes with the map, so the lookup is only redone after a map change
+    if (gSaveBlock1Ptr->location.mapGroup != sWildMonHeaderMapGroup
+     || gSaveBlock1Ptr->location.mapNum != sWildMonHeaderMapNum
+     || !sWildMonHeaderIdValid)
     {
-        const struct WildPokemonHeader *wildHeader = &gWildMonHeaders[i];
-        if (wildHeader->mapGroup == MAP_GROUP(UNDEFINED))
-            break;
+        sWildMonHeaderMapGroup = gSaveBlock1Ptr->location.mapGroup;
+        sWildMonHeaderMapNum = gSaveBlock1Ptr->location.mapNum;
+        sWildMonHeaderId = GetWildMonHeaderIdByMap(sWildMonHeaderMapGroup, sWildMonHeaderMapNum);
+        sWildMonHeaderIdValid = TRUE;
+    }
 
-        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
-            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
-        {
-            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
-                gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
-            {
-                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-                if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
-                    alteringCaveId = 0;
+    i = sWildMonHeaderId;
+    if (i == HEADER_NONE)
+        return HEADER_NONE;
 
-                i += alteringCaveId;
-            }
+    if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
+        gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
+    {
+        u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+        if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
+            alteringCaveId = 0;
 
-            return i;
-        }
+        i += alteringCaveId;
     }
 
-    return HEADER_NONE;
+    return i;
 }
 
 static u8 PickWildMonNature(void)
@@ -386,7 +378,7 @@ static u8 PickWildMonNature(void)
     struct Pokeblock *safariPokeblock;
     u8 natures[NUM_NATURES];
 
-    if (GetSafariZoneFlag() == TRUE && Random() % 100 < 80)
+    if (GetSafariZoneFlag() == TRUE && RandomUniformOverworld(100) < 80)
     {
         safariPokeblock = SafariZoneGetActivePokeblock();
         if (safariPokeblock != NULL)
@@ -397,7 +389,7 @@ static u8 PickWildMonNature(void)
             {
                 for (j = i + 1; j < NUM_NATURES; j++)
                 {
-                    if (Random() & 1)
+                    if (RandomOverworld() & 1)
                     {
                         u8 temp;
                         SWAP(natures[i], natures[j], temp);
@@ -415,7 +407,7 @@ static u8 PickWildMonNature(void)
     if (!GetMonData(&gPlayerParty[0], MON_DATA_SANITY_IS_EGG)
         && GetMonAbility(&gPlayerParty[0]) == ABILITY_SYNCHRONIZE
     #if B_SYNCHRONIZE_NATURE <= GEN_7
-        && (Random() % 2 == 0)
+        && (RandomUniformOverworld(2) == 0)
     #endif
     )
     {
@@ -423,7 +415,7 @@ static u8 PickWildMonNature(void)
     }
 
     // random nature
-    return Random() % NUM_NATURES;
+    return RandomUniformOverworld(NUM_NATURES);
 }
 
 static void CreateWildMon(u16 species, u8 level)
@@ -445,7 +437,7 @@ static void CreateWildMon(u16 species, u8 level)
     if (checkCuteCharm
         && !GetMonData(&gPlayerParty[0], MON_DATA_SANITY_IS_EGG)
         && GetMonAbility(&gPlayerParty[0]) == ABILITY_CUTE_CHARM
-        && Random() % 3 != 0)
+        && RandomUniformOverworld(3) != 0)
     {
         u16 leadingMonSpecies = GetMonData(&gPlayerParty[0], MON_DATA_SPECIES);
         u32 leadingMonPersonality = GetMonData(&gPlayerParty[0], MON_DATA_PERSONALITY);
@@ -547,7 +539,7 @@ static bool8 DoMassOutbreakEncounterTest(void)
      && gSaveBlock1Ptr->location.mapNum == gSaveBlock1Ptr->outbreakLocationMapNum
      && gSaveBlock1Ptr->location.mapGroup == gSaveBlock1Ptr->outbreakLocationMapGroup)
     {
-        if (Random() % 100 < gSaveBlock1Ptr->outbreakPokemonProbability)
+        if (RandomUniformOverworld(100) < gSaveBlock1Ptr->outbreakPokemonProbability)
             return TRUE;
     }
     return FALSE;
@@ -555,7 +547,7 @@ static bool8 DoMassOutbreakEncounterTest(void)
 
 static bool8 EncounterOddsCheck(u16 encounterRate)
 {
-    if (Random() % MAX_ENCOUNTER_RATE < encounterRate)
+    if (RandomUniformOverworld(MAX_ENCOUNTER_RATE) < encounterRate)
         return TRUE;
     else
         return FALSE;
@@ -605,7 +597,7 @@ static bool8 WildEncounterCheck(u32 encounterRate, bool8 ignoreAbility)
 // skips the wild encounter check entirely.
 static bool8 AllowWildCheckOnNewMetatile(void)
 {
-    if (Random() % 100 >= 60)
+    if (RandomUniformOverworld(100) >= 60)
         return FALSE;
     else
         return TRUE;
@@ -917,7 +909,7 @@ u16 GetLocalWildMon(bool8 *isWaterMon)
         return waterMonsInfo->wildPokemon[ChooseWildMonIndex_WaterRock()].species;
     }
     // Either land or water Pokemon
-    if ((Random() % 100) < 80)
+    if (RandomUniformOverworld(100) < 80)
     {
         return landMonsInfo->wildPokemon[ChooseWildMonIndex_Land()].species;
     }
@@ -1013,7 +1005,7 @@ static bool8 IsAbilityAllowingEncounter(u8 level)
     if (ability == ABILITY_KEEN_EYE || ability == ABILITY_INTIMIDATE)
     {
         u8 playerMonLevel = GetMonData(&gPlayerParty[0], MON_DATA_LEVEL);
-        if (playerMonLevel > 5 && level <= playerMonLevel - 5 && !(Random() % 2))
+        if (playerMonLevel > 5 && level <= playerMonLevel - 5 && !RandomUniformOverworld(2))
             return FALSE;
     }
 
@@ -1037,7 +1029,7 @@ static bool8 TryGetRandomWildMonIndexByType(const struct WildPokemon *wildMon, u
     if (validMonCount == 0 || validMonCount == numMon)
         return FALSE;
 
-    *monIndex = validIndexes[Random() % validMonCount];
+    *monIndex = validIndexes[RandomUniformOverworld(validMonCount)];
     return TRUE;
 }
 
@@ -1075,7 +1067,7 @@ static bool8 TryGetAbilityInfluencedWildMonIndex(const struct WildPokemon *wildM
         return FALSE;
     else if (GetMonAbility(&gPlayerParty[0]) != ability)
         return FALSE;
-    else if (Random() % 2 != 0)
+    else if (RandomUniformOverworld(2) != 0)
         return FALSE;
 
     return TryGetRandomWildMonIndexByType(wildMon, type, LAND_WILD_COUNT, monIndex);
@@ -1104,7 +1096,7 @@ bool8 TryDoDoubleWildBattle(void)
         return TRUE;
 #endif
 #if B_DOUBLE_WILD_CHANCE != 0
-    else if ((Random() % 100) + 1 <= B_DOUBLE_WILD_CHANCE)
+    else if (RandomUniformOverworld(100) + 1 <= B_DOUBLE_WILD_CHANCE)
         return TRUE;
 #endif
     return FALSE;
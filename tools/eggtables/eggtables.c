@@ -0,0 +1,143 @@
+// eggtables - precomputes the daycare's species lookups.
+//
+// Finding an egg's species means walking evolutions backwards, and finding its
+// egg moves means searching gEggMoves for the species' marker. Both are linear
+// scans over large tables in the game, so this tool is compiled against the
+// same data headers and prints the answers as direct lookup tables:
+//
+//   sEggSpecies[species]     - the species an egg laid by 'species' hatches as
+//   sEggMoveOffsets[species] - index of the species' first move in gEggMoves
+//   sEggMoveCounts[species]  - number of egg moves the species has
+//
+// The results follow exactly what the original searches in daycare.c did.
+
+#include <stdio.h>
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef u8 bool8;
+
+#define TRUE 1
+#define FALSE 0
+
+#include "config.h"
+#include "constants/global.h"
+#include "constants/species.h"
+#include "constants/moves.h"
+#include "constants/items.h"
+#include "constants/pokemon.h"
+#include "constants/region_map_sections.h"
+#include "constants/map_groups.h"
+
+// Must match include/pokemon.h
+struct Evolution
+{
+    u16 method;
+    u16 param;
+    u16 targetSpecies;
+};
+
+#include "data/pokemon/evolution.h"
+#include "data/pokemon/egg_moves.h"
+
+#define ARRAY_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+static u16 sPreEvolution[NUM_SPECIES];
+static u16 sEggMoveOffsets[NUM_SPECIES];
+static u16 sEggMoveCounts[NUM_SPECIES];
+
+// The first species (by id) that evolves into each species, or 0 if none does.
+static void FindPreEvolutions(void)
+{
+    u32 i, j;
+
+    for (i = NUM_SPECIES - 1; i >= 1; i--)
+    {
+        for (j = 0; j < EVOS_PER_MON; j++)
+            sPreEvolution[gEvolutionTable[i][j].targetSpecies] = i;
+    }
+}
+
+// Walks back at most EVOS_PER_MON steps, like the search it replaces.
+static u16 GetEggSpecies(u16 species)
+{
+    u32 i;
+
+    for (i = 0; i < EVOS_PER_MON && sPreEvolution[species] != 0; i++)
+        species = sPreEvolution[species];
+    return species;
+}
+
+static void FindEggMoves(void)
+{
+    u32 i, j;
+
+    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
+    {
+        u32 species;
+
+        if (gEggMoves[i] <= EGG_MOVES_SPECIES_OFFSET || gEggMoves[i] == EGG_MOVES_TERMINATOR)
+            continue;
+
+        species = gEggMoves[i] - EGG_MOVES_SPECIES_OFFSET;
+        // Only the first block for a species was ever found.
+        if (species >= NUM_SPECIES || sEggMoveOffsets[species] != 0)
+            continue;
+
+        sEggMoveOffsets[species] = i + 1;
+        for (j = i + 1; j < ARRAY_COUNT(gEggMoves) && gEggMoves[j] <= EGG_MOVES_SPECIES_OFFSET; j++)
+            sEggMoveCounts[species]++;
+    }
+}
+
+static bool8 CheckEggMoveCounts(void)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_SPECIES; i++)
+    {
+        if (sEggMoveCounts[i] > 0xFF)
+        {
+            fprintf(stderr, "eggtables: species %u has %u egg moves, more than fit in a u8\n", i, sEggMoveCounts[i]);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void PrintTable(const char *type, const char *name, const u16 *values)
+{
+    u32 i;
+
+    printf("static const %s %s[NUM_SPECIES] =\n{", type, name);
+    for (i = 0; i < NUM_SPECIES; i++)
+        printf("%s%u,", i % 16 == 0 ? "\n    " : " ", values[i]);
+    printf("\n};\n\n");
+}
+
+int main(void)
+{
+    static u16 eggSpecies[NUM_SPECIES];
+    u32 i;
+
+    FindPreEvolutions();
+    FindEggMoves();
+    if (!CheckEggMoveCounts())
+        return 1;
+    for (i = 0; i < NUM_SPECIES; i++)
+        eggSpecies[i] = GetEggSpecies(i);
+
+    printf("// This file was generated by tools/eggtables from evolution.h and egg_moves.h.\n");
+    printf("// Do not edit it directly.\n\n");
+    printf("STATIC_ASSERT(NUM_SPECIES == %u, EggTablesSpeciesCount);\n", NUM_SPECIES);
+    printf("STATIC_ASSERT(ARRAY_COUNT(gEggMoves) == %u, EggTablesEggMovesCount);\n\n", (u32)ARRAY_COUNT(gEggMoves));
+    PrintTable("u16", "sEggSpecies", eggSpecies);
+    PrintTable("u16", "sEggMoveOffsets", sEggMoveOffsets);
+    PrintTable("u8", "sEggMoveCounts", sEggMoveCounts);
+    return 0;
+}
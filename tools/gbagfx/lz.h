@@ -3,6 +3,10 @@
 #ifndef LZ_H
 #define LZ_H
 
+// Set in the reserved bits of the LZ header when the data can't be
+// decompressed straight to its destination with LZ77UnCompVram().
+#define LZ_HEADER_NOT_VRAM_SAFE 0x01
+
 unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSize);
 unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance);
 
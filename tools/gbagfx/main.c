@@ -435,6 +435,12 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     compressedData[2] = (unsigned char)(fileSize >> 8);
     compressedData[3] = (unsigned char)(fileSize >> 16);
 
+    // LZ77UnCompVram() writes 16 bits at a time, so it can't copy from the byte
+    // it's about to write, and overflowing data would spill past the destination.
+    // Flag such data so the game knows to decompress it through a buffer.
+    if (minDistance < 2 || overflowSize > 0)
+        compressedData[0] |= LZ_HEADER_NOT_VRAM_SAFE;
+
     free(buffer);
 
     WriteWholeFile(outputPath, compressedData, compressedSize);
@@ -0,0 +1,1118 @@
+// gflibbench - host checks and timings for gflib's RAM-side work.
+//
+// gflib/malloc.c, sprite.c, text.c, window.c, bg.c, blit.c and
+// src/decompress.c are compiled for the host unchanged and driven with these
+// workloads:
+//
+//   heap   - the allocations of a menu being opened and closed on top of a
+//            long-lived battle allocation, then a mixed trace of random sizes.
+//            CheckHeap() must pass after every step, and every block's
+//            contents must survive until it is freed.
+//   lz77   - tilemaps from graphics/ compressed with gbagfx's compressor and
+//            decompressed through the frame-budgeted job queue. The output
+//            must match gbagfx's own decompressor.
+//   sprite - a 64-sprite battle scene run through AnimateSprites and
+//            BuildOamBuffer (which sorts the sprites), and the same sprites
+//            created and destroyed through the sprite tile allocator. The OAM
+//            buffer must come out in priority order, and no two sprites may
+//            share tiles.
+//   text   - a two-line dialogue box printed through RenderText and
+//            CopyGlyphToWindow into a window's pixel buffer. Only the text
+//            colors may be drawn, and printing must be repeatable.
+//   bg     - menu-sized tilemap rects copied and filled in a BG's tilemap
+//            buffer, which must read back as written.
+//
+// All of these work on buffers in RAM: gMain.oamBuffer, gSprites, window
+// pixel buffers and BG tilemap buffers. Copies to VRAM, OAM and the I/O
+// registers are only queued by that code and are left out here. This
+// supersedes the note in an earlier commit that said none of this could run
+// on the host; it can once the BIOS calls it reaches are stubbed below.
+//
+// Host timings don't match the ARM7's, but they do move when the code's work
+// per frame does. Each timing is the best of several runs, printed as
+// "<name> <ns/op> <relative>", where relative is ns/op over the time of a
+// fixed reference loop run right after it. Given a baseline file in the same
+// format, the relative times are compared: any more than REGRESSION_THRESHOLD
+// percent slower fails the run. Baselines still depend on the CPU and
+// compiler, so record a new one (make baseline) on the machine that compares.
+//
+// Usage: gflibbench [baseline] < tilemap list
+
+#define _POSIX_C_SOURCE 199309L
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "global.h"
+#include "malloc.h"
+#include "decompress.h"
+#include "data.h"
+#include "pokemon.h"
+#include "main.h"
+#include "sprite.h"
+#include "text.h"
+#include "window.h"
+#include "bg.h"
+#include "fonts.h"
+#include "dma3.h"
+#include "gpu_regs.h"
+#include "m4a.h"
+#include "menu.h"
+#include "palette.h"
+#include "sound.h"
+#include "string_util.h"
+#include "dynamic_placeholder_text_util.h"
+#include "../gbagfx/lz.h"
+
+// Defined in gflib/malloc.c
+bool32 CheckHeap(void);
+
+#define MAX_BLOCKS 64
+#define MAX_TILEMAPS 32
+#define MAX_TIMINGS 16
+#define TIMING_ROUNDS 10
+#define TIMING_ATTEMPTS 3
+#define REFERENCE_LOOP_ITERATIONS 2000000
+
+// Percent slower than the baseline that counts as a regression
+#define REGRESSION_THRESHOLD 25
+
+// Stand-ins for the BIOS, and for the parts of the game that the compiled
+// files refer to but the workloads never reach.
+
+void CpuSet(const void *src, void *dest, u32 control)
+{
+    u32 count = control & 0x1FFFFF;
+    u32 i;
+
+    if (control & CPU_SET_32BIT)
+    {
+        const u32 *src32 = src;
+        u32 *dest32 = dest;
+
+        for (i = 0; i < count; i++)
+            dest32[i] = (control & CPU_SET_SRC_FIXED) ? *src32 : src32[i];
+    }
+    else
+    {
+        const u16 *src16 = src;
+        u16 *dest16 = dest;
+
+        for (i = 0; i < count; i++)
+            dest16[i] = (control & CPU_SET_SRC_FIXED) ? *src16 : src16[i];
+    }
+}
+
+// Always 32-bit, and the hardware rounds the count up to 8 words
+void CpuFastSet(const void *src, void *dest, u32 control)
+{
+    CpuSet(src, dest, CPU_SET_32BIT | (control & CPU_SET_SRC_FIXED) | (((control & 0x1FFFFF) + 7) & ~7));
+}
+
+static void Unreachable(const char *name)
+{
+    fprintf(stderr, "%s isn't available on the host\n", name);
+    exit(1);
+}
+
+void LZ77UnCompWram(const u32 *src, void *dest)             { Unreachable("LZ77UnCompWram"); }
+void LZ77UnCompVram(const u32 *src, void *dest)             { Unreachable("LZ77UnCompVram"); }
+void ObjAffineSet(struct ObjAffineSrcData *src, void *dest, s32 count, s32 offset) { Unreachable("ObjAffineSet"); }
+void BgAffineSet(struct BgAffineSrcData *src, struct BgAffineDstData *dest, s32 count) { Unreachable("BgAffineSet"); }
+void SetGpuReg(u8 regOffset, u16 value)                     { Unreachable("SetGpuReg"); }
+void SetGpuReg_ForcedBlank(u8 regOffset, u16 value)         { Unreachable("SetGpuReg_ForcedBlank"); }
+u16 GetGpuReg(u8 regOffset)                                 { Unreachable("GetGpuReg"); return 0; }
+void LoadPalette(const void *src, u16 offset, u16 size)     { Unreachable("LoadPalette"); }
+u32 GetUnownSpeciesId(u32 personality)                      { Unreachable("GetUnownSpeciesId"); return 0; }
+bool32 ShouldShowFemaleDifferences(u16 species, u32 personality) { Unreachable("ShouldShowFemaleDifferences"); return FALSE; }
+void DrawSpindaSpots(u16 species, u32 personality, u8 *dest, bool8 isFrontPic) { Unreachable("DrawSpindaSpots"); }
+void PlayBGM(u16 songNum)                                   { Unreachable("PlayBGM"); }
+void PlaySE(u16 songNum)                                    { Unreachable("PlaySE"); }
+bool8 IsSEPlaying(void)                                     { Unreachable("IsSEPlaying"); return FALSE; }
+void m4aMPlayStop(struct MusicPlayerInfo *mplayInfo)        { Unreachable("m4aMPlayStop"); }
+void m4aMPlayContinue(struct MusicPlayerInfo *mplayInfo)    { Unreachable("m4aMPlayContinue"); }
+u32 GetPlayerTextSpeed(void)                                { Unreachable("GetPlayerTextSpeed"); return 0; }
+const u8 *DynamicPlaceholderTextUtil_GetPlaceholderPtr(u8 idx) { Unreachable("DynamicPlaceholderTextUtil_GetPlaceholderPtr"); return NULL; }
+u16 FontFunc_Braille(struct TextPrinter *textPrinter)       { Unreachable("FontFunc_Braille"); return 0; }
+u32 GetGlyphWidth_Braille(u16 glyphId, bool32 isJapanese)   { Unreachable("GetGlyphWidth_Braille"); return 0; }
+
+// Transfers to VRAM are dropped.
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode) { return 0; }
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)       { return 0; }
+s16 CheckForSpaceForDma3Request(s16 index)                          { return 0; }
+
+const struct CompressedSpriteSheet gMonFrontPicTable[1];
+const struct CompressedSpriteSheet gMonBackPicTable[1];
+const struct CompressedSpriteSheet gMonFrontPicTableFemale[1];
+const struct CompressedSpriteSheet gMonBackPicTableFemale[1];
+
+struct Main gMain;
+struct MusicPlayerInfo gMPlayInfo_BGM;
+u32 gBattleTypeFlags;
+u8 gStringVar1[0x100];
+u8 gStringVar2[0x100];
+u8 gStringVar3[0x100];
+
+// The fonts are generated from graphics/fonts at build time. The work done
+// per glyph doesn't depend on its shape, so a fixed pattern and width stand in.
+#define FONT_GLYPHS      0x200
+#define FONT_GLYPH_WORDS (0x20 * FONT_GLYPHS)
+#define FONT_GLYPH_WIDTH 6
+
+#define FONT_PATTERN { [0 ... FONT_GLYPH_WORDS - 1] = 0x1B6C }
+#define FONT_WIDTHS  { [0 ... FONT_GLYPHS - 1] = FONT_GLYPH_WIDTH }
+
+const u16 gFontNormalLatinGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u8 gFontNormalLatinGlyphWidths[FONT_GLYPHS] = FONT_WIDTHS;
+const u16 gFontNormalJapaneseGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u16 gFontSmallLatinGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u8 gFontSmallLatinGlyphWidths[FONT_GLYPHS] = FONT_WIDTHS;
+const u16 gFontSmallJapaneseGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u16 gFontShortLatinGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u8 gFontShortLatinGlyphWidths[FONT_GLYPHS] = FONT_WIDTHS;
+const u16 gFontShortJapaneseGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u8 gFontShortJapaneseGlyphWidths[FONT_GLYPHS] = FONT_WIDTHS;
+const u16 gFontNarrowLatinGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u8 gFontNarrowLatinGlyphWidths[FONT_GLYPHS] = FONT_WIDTHS;
+const u16 gFontSmallNarrowLatinGlyphs[FONT_GLYPH_WORDS] = FONT_PATTERN;
+const u8 gFontSmallNarrowLatinGlyphWidths[FONT_GLYPHS] = FONT_WIDTHS;
+
+struct Timing
+{
+    char name[32];
+    double ns;
+    double relative;
+};
+
+// Mapped at EWRAM's own address, since bg.c only touches tilemap buffers that
+// lie below the end of IWRAM.
+static u8 *sHeap;
+static struct Timing sTimings[MAX_TIMINGS];
+static u32 sNumTimings;
+static u32 sRngValue = 0x5EED;
+
+static u32 NextRandom(void)
+{
+    sRngValue = 1103515245 * sRngValue + 24691;
+    return sRngValue >> 16;
+}
+
+static double GetTimeNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// A fixed stretch of dependent integer work, timed right after each run. How
+// fast the machine is at that moment moves it as much as the run, so the run's
+// time relative to it is what gets compared with the baseline.
+static double TimeReferenceLoop(void)
+{
+    volatile u32 sink;
+    u32 value = 0x5EED;
+    double start = GetTimeNs();
+    u32 i;
+
+    for (i = 0; i < REFERENCE_LOOP_ITERATIONS; i++)
+    {
+        value ^= value << 13;
+        value ^= value >> 17;
+        value ^= value << 5;
+    }
+    sink = value;
+    (void)sink;
+    return (GetTimeNs() - start) / REFERENCE_LOOP_ITERATIONS;
+}
+
+// Keeps the fastest of the runs for each name, which is the one least
+// disturbed by the rest of the machine.
+static void AddTiming(const char *name, double totalNs, u32 ops)
+{
+    double ns = totalNs / ops;
+    double relative = ns / TimeReferenceLoop();
+    u32 i;
+
+    for (i = 0; i < sNumTimings; i++)
+    {
+        if (strcmp(sTimings[i].name, name) == 0)
+        {
+            if (ns < sTimings[i].ns)
+                sTimings[i].ns = ns;
+            if (relative < sTimings[i].relative)
+                sTimings[i].relative = relative;
+            return;
+        }
+    }
+    if (sNumTimings == MAX_TIMINGS)
+        return;
+    snprintf(sTimings[sNumTimings].name, sizeof(sTimings[sNumTimings].name), "%s", name);
+    sTimings[sNumTimings].ns = ns;
+    sTimings[sNumTimings].relative = relative;
+    sNumTimings++;
+}
+
+// Elsewhere than Linux the address is only a hint, which is checked below.
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0
+#endif
+
+static bool32 MapHeap(void)
+{
+    void *ewram = (void *)EWRAM_START;
+
+    sHeap = mmap(ewram, HEAP_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (sHeap != ewram)
+    {
+        printf("FAIL heap: can't map 0x%X bytes at 0x%08X\n", HEAP_SIZE, EWRAM_START);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// Heap
+
+struct Block
+{
+    u8 *ptr;
+    u32 size;
+    u8 fill;
+};
+
+static bool32 CheckHeapAfter(const char *name)
+{
+    if (CheckHeap())
+        return TRUE;
+    printf("FAIL heap: inconsistent after %s\n", name);
+    return FALSE;
+}
+
+static bool32 FreeBlock(struct Block *block)
+{
+    u32 i;
+
+    for (i = 0; i < block->size; i++)
+    {
+        if (block->ptr[i] != block->fill)
+        {
+            printf("FAIL heap: block at +0x%X was overwritten\n", (u32)(block->ptr - sHeap));
+            return FALSE;
+        }
+    }
+    Free(block->ptr);
+    block->ptr = NULL;
+    return CheckHeapAfter("Free");
+}
+
+static bool32 AllocBlock(struct Block *block, u32 size, bool32 zeroed)
+{
+    u32 i;
+
+    block->ptr = zeroed ? AllocZeroed(size) : Alloc(size);
+    block->size = size;
+    block->fill = NextRandom();
+    if (block->ptr == NULL)
+        return TRUE;
+    if (zeroed)
+    {
+        for (i = 0; i < size; i++)
+        {
+            if (block->ptr[i] != 0)
+            {
+                printf("FAIL heap: AllocZeroed(0x%X) isn't zeroed\n", size);
+                return FALSE;
+            }
+        }
+    }
+    memset(block->ptr, block->fill, size);
+    return CheckHeapAfter(zeroed ? "AllocZeroed" : "Alloc");
+}
+
+// Window tile buffers, a tilemap buffer, list menu items and the menu's state.
+static const u16 sMenuAllocSizes[] = {0x800, 0x400, 0x600, 0x200, 0x80, 0x44, 0x1C};
+// The menu frees in a different order than it allocated.
+static const u8 sMenuFreeOrder[] = {5, 0, 4, 2, 6, 1, 3};
+
+static bool32 RunMenuTrace(bool32 check, u32 *ops)
+{
+    struct Block blocks[ARRAY_COUNT(sMenuAllocSizes)];
+    u32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sMenuAllocSizes); i++)
+    {
+        if (check)
+        {
+            if (!AllocBlock(&blocks[i], sMenuAllocSizes[i], i & 1))
+                return FALSE;
+        }
+        else
+        {
+            blocks[i].ptr = (i & 1) ? AllocZeroed(sMenuAllocSizes[i]) : Alloc(sMenuAllocSizes[i]);
+        }
+    }
+    for (i = 0; i < ARRAY_COUNT(sMenuFreeOrder); i++)
+    {
+        if (check)
+        {
+            if (!FreeBlock(&blocks[sMenuFreeOrder[i]]))
+                return FALSE;
+        }
+        else
+        {
+            Free(blocks[sMenuFreeOrder[i]].ptr);
+        }
+    }
+    *ops += 2 * ARRAY_COUNT(sMenuAllocSizes);
+    return TRUE;
+}
+
+static bool32 RunRandomTrace(u32 steps)
+{
+    struct Block blocks[MAX_BLOCKS] = {0};
+    u32 i;
+
+    for (i = 0; i < steps; i++)
+    {
+        struct Block *block = &blocks[NextRandom() % MAX_BLOCKS];
+
+        if (block->ptr != NULL)
+        {
+            if (!FreeBlock(block))
+                return FALSE;
+        }
+        else
+        {
+            // Mostly small, with the odd buffer the size of a whole tileset
+            u32 size = (NextRandom() % 8 == 0) ? 0x800 + NextRandom() % 0x2000 : 1 + NextRandom() % 0x100;
+
+            if (!AllocBlock(block, size, NextRandom() & 1))
+                return FALSE;
+        }
+    }
+    for (i = 0; i < MAX_BLOCKS; i++)
+    {
+        if (blocks[i].ptr != NULL && !FreeBlock(&blocks[i]))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static bool32 RunHeap(bool32 report)
+{
+    struct Block battle;
+    double start;
+    u32 i, ops = 0;
+
+    InitHeap(sHeap, HEAP_SIZE);
+    if (!AllocBlock(&battle, 0x3000, TRUE) || !RunMenuTrace(TRUE, &ops) || !RunRandomTrace(20000) || !FreeBlock(&battle))
+        return FALSE;
+
+    InitHeap(sHeap, HEAP_SIZE);
+    battle.ptr = Alloc(0x3000);
+    ops = 0;
+    start = GetTimeNs();
+    for (i = 0; i < 100000; i++)
+        RunMenuTrace(FALSE, &ops);
+    AddTiming("heap_menu_alloc_free", GetTimeNs() - start, ops);
+    Free(battle.ptr);
+
+    if (!CheckHeap())
+    {
+        printf("FAIL heap: inconsistent after the timed trace\n");
+        return FALSE;
+    }
+    if (report)
+        printf("ok   heap\n");
+    return TRUE;
+}
+
+// LZ77
+
+struct Tilemap
+{
+    u8 *compressed;
+    u8 *expected;
+    int size;
+};
+
+static bool32 LoadTilemap(const char *path, struct Tilemap *tilemap)
+{
+    FILE *file = fopen(path, "rb");
+    u8 *raw;
+    long size;
+    int compressedSize;
+
+    if (file == NULL)
+    {
+        printf("FAIL lz77: can't open %s\n", path);
+        return FALSE;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    raw = malloc(size);
+    if (raw == NULL || fread(raw, 1, size, file) != (size_t)size)
+    {
+        printf("FAIL lz77: can't read %s\n", path);
+        fclose(file);
+        return FALSE;
+    }
+    fclose(file);
+
+    // The same minimum distance the ROM's graphics are built with
+    tilemap->compressed = LZCompress(raw, size, &compressedSize, 2);
+    tilemap->expected = LZDecompress(tilemap->compressed, compressedSize, &tilemap->size);
+    free(raw);
+    return tilemap->compressed != NULL && tilemap->expected != NULL;
+}
+
+static bool32 RunLZ77(const struct Tilemap *tilemaps, u32 count, bool32 report)
+{
+    static u8 dest[MAX_TILEMAPS][0x4000];
+    u8 jobIds[MAX_TILEMAPS];
+    double start;
+    u32 i, j, frames, bytes = 0;
+
+    if (count == 0)
+    {
+        printf("FAIL lz77: no tilemaps given\n");
+        return FALSE;
+    }
+
+    // Queued a few at a time, the way the map loader does, and run a frame's
+    // budget at a time
+    frames = 0;
+    for (i = 0; i < count; i += j)
+    {
+        for (j = 0; i + j < count; j++)
+        {
+            jobIds[i + j] = StartLZ77Decompression((const u32 *)tilemaps[i + j].compressed, dest[i + j]);
+            if (jobIds[i + j] == LZ77_JOB_NONE)
+                break;
+        }
+        for (;;)
+        {
+            bool32 done = TRUE;
+            u32 k;
+
+            for (k = i; k < i + j; k++)
+            {
+                if (!IsLZ77DecompressionDone(jobIds[k]))
+                    done = FALSE;
+            }
+            if (done)
+                break;
+            RunLZ77DecompressionQueue();
+            frames++;
+        }
+    }
+    for (i = 0; i < count; i++)
+    {
+        if ((u32)tilemaps[i].size > sizeof(dest[i]) || memcmp(dest[i], tilemaps[i].expected, tilemaps[i].size) != 0)
+        {
+            printf("FAIL lz77: tilemap %u decompressed wrong through the queue\n", i);
+            return FALSE;
+        }
+        bytes += tilemaps[i].size;
+    }
+    if (report)
+        printf("ok   lz77 (%u bytes over %u frames)\n", bytes, frames);
+
+    start = GetTimeNs();
+    for (j = 0; j < 1000; j++)
+    {
+        for (i = 0; i < count; i++)
+            FinishLZ77Decompression(StartLZ77Decompression((const u32 *)tilemaps[i].compressed, dest[i]));
+    }
+    AddTiming("lz77_per_kb", GetTimeNs() - start, 1000 * bytes / 1024);
+    return TRUE;
+}
+
+// Sprites
+
+#define SCENE_MONS      4
+#define SCENE_BOXES     4
+#define SCENE_PARTICLES (MAX_OAM_SPRITES_SCENE - SCENE_MONS - SCENE_BOXES)
+#define MAX_OAM_SPRITES_SCENE 64
+
+#define TAG_HEALTHBOX 0x1000
+#define TAG_PARTICLE  0x1001
+
+// 64x64 pics with two frames, loaded a frame at a time like battler sprites
+static u8 sMonPicFrames[2][64 * 64 / 2];
+
+static const struct SpriteFrameImage sMonPicImages[] =
+{
+    {sMonPicFrames[0], sizeof(sMonPicFrames[0])},
+    {sMonPicFrames[1], sizeof(sMonPicFrames[1])},
+};
+
+static const union AnimCmd sAnim_MonIdle[] =
+{
+    ANIMCMD_FRAME(0, 12),
+    ANIMCMD_FRAME(1, 12),
+    ANIMCMD_JUMP(0),
+};
+
+static const union AnimCmd sAnim_Particle[] =
+{
+    ANIMCMD_FRAME(0, 3),
+    ANIMCMD_FRAME(1, 3),
+    ANIMCMD_FRAME(2, 3),
+    ANIMCMD_FRAME(3, 3),
+    ANIMCMD_JUMP(0),
+};
+
+static const union AnimCmd *const sAnims_MonIdle[] = {sAnim_MonIdle};
+static const union AnimCmd *const sAnims_Particle[] = {sAnim_Particle};
+
+static const struct OamData sOam_Mon =
+{
+    .shape = SPRITE_SHAPE(64x64),
+    .size = SPRITE_SIZE(64x64),
+    .priority = 2,
+};
+
+static const struct OamData sOam_Healthbox =
+{
+    .shape = SPRITE_SHAPE(64x32),
+    .size = SPRITE_SIZE(64x32),
+    .priority = 1,
+};
+
+static const struct OamData sOam_Particle =
+{
+    .shape = SPRITE_SHAPE(16x16),
+    .size = SPRITE_SIZE(16x16),
+    .priority = 1,
+};
+
+static void SpriteCB_Bob(struct Sprite *sprite)
+{
+    sprite->y2 = (sprite->data[0]++ >> 2 & 7) - 4;
+}
+
+// Drifts up the screen, so the sort order changes from frame to frame
+static void SpriteCB_Particle(struct Sprite *sprite)
+{
+    sprite->x2 += sprite->data[1];
+    if (sprite->y2-- < -DISPLAY_HEIGHT)
+        sprite->y2 = 0;
+}
+
+static const struct SpriteTemplate sSpriteTemplate_Mon =
+{
+    .tileTag = TAG_NONE,
+    .paletteTag = TAG_NONE,
+    .oam = &sOam_Mon,
+    .anims = sAnims_MonIdle,
+    .images = sMonPicImages,
+    .affineAnims = gDummySpriteAffineAnimTable,
+    .callback = SpriteCB_Bob,
+};
+
+static const struct SpriteTemplate sSpriteTemplate_Healthbox =
+{
+    .tileTag = TAG_HEALTHBOX,
+    .paletteTag = TAG_NONE,
+    .oam = &sOam_Healthbox,
+    .anims = gDummySpriteAnimTable,
+    .images = NULL,
+    .affineAnims = gDummySpriteAffineAnimTable,
+    .callback = SpriteCallbackDummy,
+};
+
+static const struct SpriteTemplate sSpriteTemplate_Particle =
+{
+    .tileTag = TAG_PARTICLE,
+    .paletteTag = TAG_NONE,
+    .oam = &sOam_Particle,
+    .anims = sAnims_Particle,
+    .images = NULL,
+    .affineAnims = gDummySpriteAffineAnimTable,
+    .callback = SpriteCB_Particle,
+};
+
+static bool32 LoadSceneSheets(void)
+{
+    // Tiles only; the pixel data would be copied to VRAM
+    struct SpriteSheet healthbox = {NULL, SCENE_BOXES * 64 * 32 / 2, TAG_HEALTHBOX};
+    struct SpriteSheet particle = {NULL, 4 * 16 * 16 / 2, TAG_PARTICLE};
+
+    return AllocTilesForSpriteSheet(&healthbox) != 0xFFFF
+        && AllocTilesForSpriteSheet(&particle) != 0xFFFF;
+}
+
+static bool32 CreateScene(u8 *spriteIds)
+{
+    u32 i, n = 0;
+
+    for (i = 0; i < SCENE_MONS; i++)
+        spriteIds[n++] = CreateSprite(&sSpriteTemplate_Mon, 72 + (i & 1) * 104, 48 + (i >> 1) * 40, 30 - i);
+    for (i = 0; i < SCENE_BOXES; i++)
+        spriteIds[n++] = CreateSprite(&sSpriteTemplate_Healthbox, 60 + (i & 1) * 120, 24 + (i >> 1) * 80, 1);
+    for (i = 0; i < SCENE_PARTICLES; i++)
+    {
+        spriteIds[n] = CreateSprite(&sSpriteTemplate_Particle, NextRandom() % DISPLAY_WIDTH, DISPLAY_HEIGHT + NextRandom() % 32, NextRandom() % 8);
+        gSprites[spriteIds[n]].data[1] = (i % 3) - 1;
+        gSprites[spriteIds[n]].y2 = -(s16)(NextRandom() % DISPLAY_HEIGHT);
+        n++;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        if (spriteIds[i] == MAX_SPRITES)
+        {
+            printf("FAIL sprite: couldn't create sprite %u of the scene\n", i);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void DestroyScene(const u8 *spriteIds)
+{
+    u32 i;
+
+    for (i = 0; i < MAX_OAM_SPRITES_SCENE; i++)
+        DestroySprite(&gSprites[spriteIds[i]]);
+}
+
+// The ProcessSpriteCopyRequests of VBlank, without the copies
+static void RunSceneFrame(void)
+{
+    AnimateSprites();
+    BuildOamBuffer();
+    ClearSpriteCopyRequests();
+}
+
+static bool32 CheckScene(void)
+{
+    u32 i, j;
+
+    for (i = 0; i < MAX_OAM_SPRITES_SCENE; i++)
+    {
+        if (gMain.oamBuffer[i].affineMode == ST_OAM_AFFINE_ERASE)
+        {
+            printf("FAIL sprite: only %u of the scene's sprites reached the OAM buffer\n", i);
+            return FALSE;
+        }
+        if (i > 0 && gMain.oamBuffer[i].priority < gMain.oamBuffer[i - 1].priority)
+        {
+            printf("FAIL sprite: OAM entry %u is out of priority order\n", i);
+            return FALSE;
+        }
+    }
+
+    // The mon pics own their tiles; nothing else may overlap them
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        const struct Sprite *mon = &gSprites[i];
+
+        if (!mon->inUse || mon->usingSheet)
+            continue;
+        for (j = 0; j < MAX_SPRITES; j++)
+        {
+            const struct Sprite *other = &gSprites[j];
+            u32 otherStart, otherEnd;
+
+            if (j == i || !other->inUse)
+                continue;
+            otherStart = other->usingSheet ? other->sheetTileStart : other->oam.tileNum;
+            otherEnd = otherStart + (other->usingSheet ? 1 : sizeof(sMonPicFrames[0]) / TILE_SIZE_4BPP);
+            if (otherStart < mon->oam.tileNum + sizeof(sMonPicFrames[0]) / TILE_SIZE_4BPP && mon->oam.tileNum < otherEnd)
+            {
+                printf("FAIL sprite: sprites %u and %u share tiles\n", i, j);
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+static bool32 RunSprites(bool32 report)
+{
+    u8 spriteIds[MAX_OAM_SPRITES_SCENE];
+    double start;
+    u32 i;
+
+    ResetSpriteData();
+    FreeAllSpritePalettes();
+    if (!LoadSceneSheets())
+    {
+        printf("FAIL sprite: no room for the scene's sprite sheets\n");
+        return FALSE;
+    }
+    if (!CreateScene(spriteIds))
+        return FALSE;
+    for (i = 0; i < 240; i++)
+    {
+        RunSceneFrame();
+        if (!CheckScene())
+            return FALSE;
+    }
+
+    start = GetTimeNs();
+    for (i = 0; i < 20000; i++)
+        RunSceneFrame();
+    AddTiming("sprite_scene_frame", GetTimeNs() - start, 20000);
+
+    start = GetTimeNs();
+    for (i = 0; i < 5000; i++)
+    {
+        DestroyScene(spriteIds);
+        CreateScene(spriteIds);
+    }
+    AddTiming("sprite_create_destroy", GetTimeNs() - start, 5000 * MAX_OAM_SPRITES_SCENE);
+    RunSceneFrame();
+    if (!CheckScene())
+        return FALSE;
+
+    DestroyScene(spriteIds);
+    ResetSpriteData();
+    if (report)
+        printf("ok   sprite\n");
+    return TRUE;
+}
+
+// Text and BGs
+
+#define DIALOGUE_WIDTH  27
+#define DIALOGUE_HEIGHT 4
+
+static const struct BgTemplate sBgTemplates[] =
+{
+    {
+        .bg = 0,
+        .charBaseIndex = 2,
+        .mapBaseIndex = 31,
+        .screenSize = 0,
+        .paletteMode = 0,
+        .priority = 0,
+        .baseTile = 0,
+    },
+};
+
+static const struct WindowTemplate sWindowTemplates[] =
+{
+    {
+        .bg = 0,
+        .tilemapLeft = 2,
+        .tilemapTop = 15,
+        .width = DIALOGUE_WIDTH,
+        .height = DIALOGUE_HEIGHT,
+        .paletteNum = 15,
+        .baseBlock = 1,
+    },
+    DUMMY_WIN_TEMPLATE,
+};
+
+static const char sDialogueAscii[] = "Wally's Zigzagoon used Tackle!\nThe wild Ralts fainted. Wally gained 12 Exp. Points!";
+
+// The game's strings are built with preproc; only what the dialogue uses is
+// converted here.
+static void EncodeDialogue(u8 *dest, const char *src)
+{
+    for (; *src != '\0'; src++, dest++)
+    {
+        if (*src >= 'A' && *src <= 'Z')
+            *dest = CHAR_A + (*src - 'A');
+        else if (*src >= 'a' && *src <= 'z')
+            *dest = CHAR_a + (*src - 'a');
+        else if (*src >= '0' && *src <= '9')
+            *dest = CHAR_0 + (*src - '0');
+        else if (*src == '!')
+            *dest = CHAR_EXCL_MARK;
+        else if (*src == '.')
+            *dest = CHAR_PERIOD;
+        else if (*src == '\'')
+            *dest = CHAR_SGL_QUOTE_RIGHT;
+        else if (*src == '\n')
+            *dest = CHAR_NEWLINE;
+        else
+            *dest = CHAR_SPACE;
+    }
+    *dest = EOS;
+}
+
+static void PrintDialogue(const u8 *str)
+{
+    FillWindowPixelBuffer(0, PIXEL_FILL(TEXT_COLOR_WHITE));
+    AddTextPrinterParameterized(0, FONT_NORMAL, str, 0, 1, 0, NULL);
+}
+
+static bool32 CheckDialogue(const u8 *first)
+{
+    const u8 *pixels = gWindows[0].tileData;
+    u32 size = DIALOGUE_WIDTH * DIALOGUE_HEIGHT * TILE_SIZE_4BPP;
+    u32 i, drawn = 0;
+
+    for (i = 0; i < size * 2; i++)
+    {
+        u32 color = (pixels[i / 2] >> ((i & 1) * 4)) & 0xF;
+
+        if (color == TEXT_COLOR_DARK_GRAY || color == TEXT_COLOR_LIGHT_GRAY)
+            drawn++;
+        else if (color != TEXT_COLOR_WHITE)
+        {
+            printf("FAIL text: pixel %u has color %u\n", i, color);
+            return FALSE;
+        }
+    }
+    if (drawn == 0)
+    {
+        printf("FAIL text: nothing was drawn\n");
+        return FALSE;
+    }
+    if (first != NULL && memcmp(first, pixels, size) != 0)
+    {
+        printf("FAIL text: printing the same dialogue twice drew different pixels\n");
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static bool32 RunText(bool32 report)
+{
+    static u8 dialogue[sizeof(sDialogueAscii)];
+    static u8 firstPixels[DIALOGUE_WIDTH * DIALOGUE_HEIGHT * TILE_SIZE_4BPP];
+    double start;
+    u32 i;
+
+    EncodeDialogue(dialogue, sDialogueAscii);
+    PrintDialogue(dialogue);
+    if (!CheckDialogue(NULL))
+        return FALSE;
+    memcpy(firstPixels, gWindows[0].tileData, sizeof(firstPixels));
+    PrintDialogue(dialogue);
+    if (!CheckDialogue(firstPixels))
+        return FALSE;
+
+    start = GetTimeNs();
+    for (i = 0; i < 20000; i++)
+        PrintDialogue(dialogue);
+    AddTiming("text_dialogue_box", GetTimeNs() - start, 20000);
+    if (report)
+        printf("ok   text\n");
+    return TRUE;
+}
+
+#define RECT_WIDTH  10
+#define RECT_HEIGHT 6
+
+static bool32 CheckBgRect(u32 x, u32 y, const u16 *expected, u32 step)
+{
+    const u16 *tilemap = GetBgTilemapBuffer(0);
+    u32 i, j;
+
+    for (j = 0; j < RECT_HEIGHT; j++)
+    {
+        for (i = 0; i < RECT_WIDTH; i++)
+        {
+            if (tilemap[(y + j) * 32 + x + i] != expected[(j * RECT_WIDTH + i) * step])
+            {
+                printf("FAIL bg: tilemap entry (%u, %u) doesn't match what was written\n", x + i, y + j);
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+// A menu's worth of rect copies and clears, with the rect moving about
+static void RunBgRects(const u16 *rect, u32 *ops)
+{
+    u32 i;
+
+    for (i = 0; i < 9; i++)
+    {
+        u32 x = (i % 3) * RECT_WIDTH, y = (i / 3) * RECT_HEIGHT;
+
+        CopyToBgTilemapBufferRect(0, rect, x, y, RECT_WIDTH, RECT_HEIGHT);
+        FillBgTilemapBufferRect(0, 0, x, y, RECT_WIDTH, RECT_HEIGHT, 15);
+    }
+    *ops += 18;
+}
+
+static bool32 RunBg(bool32 report)
+{
+    static u16 rect[RECT_WIDTH * RECT_HEIGHT];
+    const u16 cleared = 15 << 12;
+    double start;
+    u32 i, ops;
+
+    if (GetBgTilemapBuffer(0) == NULL)
+    {
+        printf("FAIL bg: no tilemap buffer\n");
+        return FALSE;
+    }
+    for (i = 0; i < ARRAY_COUNT(rect); i++)
+        rect[i] = (NextRandom() & 0xF3FF) | 0x0400;
+    CopyToBgTilemapBufferRect(0, rect, 3, 5, RECT_WIDTH, RECT_HEIGHT);
+    if (!CheckBgRect(3, 5, rect, 1))
+        return FALSE;
+    FillBgTilemapBufferRect(0, 0, 3, 5, RECT_WIDTH, RECT_HEIGHT, 15);
+    if (!CheckBgRect(3, 5, &cleared, 0))
+        return FALSE;
+
+    ops = 0;
+    start = GetTimeNs();
+    for (i = 0; i < 20000; i++)
+        RunBgRects(rect, &ops);
+    AddTiming("bg_tilemap_rect", GetTimeNs() - start, ops);
+    if (report)
+        printf("ok   bg\n");
+    return TRUE;
+}
+
+static bool32 RunTextAndBg(bool32 report)
+{
+    bool32 passed;
+
+    InitHeap(sHeap, HEAP_SIZE);
+    InitBgsFromTemplates(0, sBgTemplates, ARRAY_COUNT(sBgTemplates));
+    if (!InitWindows(sWindowTemplates))
+    {
+        printf("FAIL text: couldn't create the dialogue window\n");
+        return FALSE;
+    }
+    DeactivateAllTextPrinters();
+    SetDefaultFontsPointer();
+
+    passed = RunText(report);
+    if (!RunBg(report))
+        passed = FALSE;
+    FreeAllWindowBuffers();
+    return passed;
+}
+
+// Results
+
+static bool32 GetBaselineTiming(FILE *file, const char *name, double *relative)
+{
+    char line[128], lineName[32];
+    double ns, value;
+
+    rewind(file);
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (sscanf(line, "%31s %lf %lf", lineName, &ns, &value) == 3 && strcmp(lineName, name) == 0)
+        {
+            *relative = value;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// Percent slower than the baseline, relative to the reference loop
+static bool32 GetTimingChange(FILE *baseline, const struct Timing *timing, double *change)
+{
+    double old;
+
+    if (baseline == NULL || !GetBaselineTiming(baseline, timing->name, &old) || old <= 0)
+        return FALSE;
+    *change = 100 * (timing->relative - old) / old;
+    return TRUE;
+}
+
+static bool32 HasRegression(FILE *baseline)
+{
+    double change;
+    u32 i;
+
+    for (i = 0; i < sNumTimings; i++)
+    {
+        if (GetTimingChange(baseline, &sTimings[i], &change) && change > REGRESSION_THRESHOLD)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// Returns FALSE if any timing regressed past REGRESSION_THRESHOLD.
+static bool32 PrintTimings(FILE *baseline)
+{
+    bool32 passed = TRUE;
+    double change;
+    u32 i;
+
+    for (i = 0; i < sNumTimings; i++)
+    {
+        if (GetTimingChange(baseline, &sTimings[i], &change))
+        {
+            printf("%s %.1f %.2f (%+.1f%%)\n", sTimings[i].name, sTimings[i].ns, sTimings[i].relative, change);
+            if (change > REGRESSION_THRESHOLD)
+            {
+                printf("FAIL %s: %.1f%% slower than the baseline (threshold %d%%)\n", sTimings[i].name, change, REGRESSION_THRESHOLD);
+                passed = FALSE;
+            }
+        }
+        else
+        {
+            printf("%s %.1f %.2f\n", sTimings[i].name, sTimings[i].ns, sTimings[i].relative);
+        }
+    }
+    return passed;
+}
+
+static bool32 RunRounds(const struct Tilemap *tilemaps, u32 count, bool32 report)
+{
+    u32 round;
+
+    for (round = 0; round < TIMING_ROUNDS; round++)
+    {
+        bool32 reportRound = (report && round == 0);
+
+        if (!RunHeap(reportRound)
+         || !RunLZ77(tilemaps, count, reportRound)
+         || !RunSprites(reportRound)
+         || !RunTextAndBg(reportRound))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+int main(int argc, char **argv)
+{
+    static struct Tilemap tilemaps[MAX_TILEMAPS];
+    char path[256];
+    FILE *baseline = NULL;
+    u32 count = 0, attempt;
+    bool32 passed;
+
+    while (count < MAX_TILEMAPS && scanf("%255s", path) == 1)
+    {
+        if (!LoadTilemap(path, &tilemaps[count]))
+            return 1;
+        count++;
+    }
+
+    if (argc > 1)
+    {
+        baseline = fopen(argv[1], "r");
+        if (baseline == NULL)
+            printf("no baseline at %s\n", argv[1]);
+    }
+
+    if (!MapHeap())
+        return 1;
+
+    // Each round runs every workload once, so the best of each is taken from
+    // runs spread over the whole process rather than back to back. A timing
+    // that still looks slower than the baseline gets more rounds before it
+    // counts, which a real regression survives and a busy machine doesn't.
+    // Without a baseline every attempt runs, since the output may become one.
+    passed = RunRounds(tilemaps, count, TRUE);
+    for (attempt = 1; passed && attempt < TIMING_ATTEMPTS && (baseline == NULL || HasRegression(baseline)); attempt++)
+        passed = RunRounds(tilemaps, count, FALSE);
+
+    if (!PrintTimings(baseline))
+        passed = FALSE;
+    if (baseline != NULL)
+        fclose(baseline);
+    return passed ? 0 : 1;
+}
@@ -26,6 +26,20 @@ string get_custom_var(string key)
     return customVars[key];
 }
 
+std::map<string, json> customVarLists;
+
+void append_custom_var_list(string key, json value)
+{
+    customVarLists[key].push_back(value);
+}
+
+json get_custom_var_list(string key)
+{
+    if (customVarLists.find(key) == customVarLists.end())
+        return json::array();
+    return customVarLists[key];
+}
+
 int main(int argc, char *argv[])
 {
     if (argc != 4)
@@ -69,6 +83,17 @@ int main(int argc, char *argv[])
         return get_custom_var(key);
     });
 
+    env.add_callback("appendVarList", 2, [=](Arguments& args) {
+        string key = args.at(0)->get<string>();
+        append_custom_var_list(key, *args.at(1));
+        return "";
+    });
+
+    env.add_callback("getVarList", 1, [=](Arguments& args) {
+        string key = args.at(0)->get<string>();
+        return get_custom_var_list(key);
+    });
+
     env.add_callback("concat", 2, [](Arguments& args) {
         string first = args.at(0)->get<string>();
         string second = args.at(1)->get<string>();
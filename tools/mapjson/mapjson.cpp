@@ -10,7 +10,7 @@ using std::string;
 using std::vector;
 
 #include <algorithm>
-using std::sort; using std::find;
+using std::sort; using std::stable_sort; using std::find;
 
 #include <map>
 using std::map;
@@ -24,6 +24,11 @@ using std::ostringstream;
 #include <limits>
 using std::numeric_limits;
 
+#include <utility>
+using std::pair; using std::make_pair;
+
+#include <cstdint>
+
 #include "json11.h"
 using json11::Json;
 
@@ -176,6 +181,32 @@ string generate_map_connections_text(Json map_data) {
     return text.str();
 }
 
+// The game binary searches these instead of scanning all of a map's events on every step.
+// Events at the same position keep their original order, since the first match takes priority.
+string generate_event_order_text(const vector<Json> &events, string label, ostringstream &text) {
+    vector<pair<unsigned long, unsigned int>> order;
+
+    for (unsigned int i = 0; i < events.size(); i++) {
+        if (!events[i]["x"].is_number() || !events[i]["y"].is_number())
+            return "0x0";
+        // Sorted the same way the game compares positions, as u16s
+        unsigned long x = static_cast<uint16_t>(events[i]["x"].int_value());
+        unsigned long y = static_cast<uint16_t>(events[i]["y"].int_value());
+        order.push_back(make_pair((y << 16) | x, i));
+    }
+
+    stable_sort(order.begin(), order.end(), [](const pair<unsigned long, unsigned int> &a, const pair<unsigned long, unsigned int> &b) {
+        return a.first < b.first;
+    });
+
+    text << label << ":\n\t.byte ";
+    for (unsigned int i = 0; i < order.size(); i++)
+        text << (i ? ", " : "") << order[i].second;
+    text << "\n\n";
+
+    return label;
+}
+
 string generate_map_events_text(Json map_data) {
     if (map_data.object_items().find("shared_events_map") != map_data.object_items().end())
         return string("\n");
@@ -187,6 +218,7 @@ string generate_map_events_text(Json map_data) {
     text << "@\n@ DO NOT MODIFY THIS FILE! It is auto-generated from data/maps/" << mapName << "/map.json\n@\n\n";
 
     string objects_label, warps_label, coords_label, bgs_label;
+    vector<Json> warps, coords, bgs;
 
     if (map_data["object_events"].array_items().size() > 0) {
         objects_label = mapName + "_ObjectEvents";
@@ -221,6 +253,7 @@ string generate_map_events_text(Json map_data) {
                  << json_to_string(warp_event, "elevation") << ", "
                  << json_to_string(warp_event, "dest_warp_id") << ", "
                  << json_to_string(warp_event, "dest_map") << "\n";
+            warps.push_back(warp_event);
         }
         text << "\n";
     } else {
@@ -239,6 +272,7 @@ string generate_map_events_text(Json map_data) {
                      << json_to_string(coord_event, "var") << ", "
                      << json_to_string(coord_event, "var_value") << ", "
                      << json_to_string(coord_event, "script") << "\n";
+                coords.push_back(coord_event);
             }
             else if (coord_event["type"] == "weather") {
                 text << "\tcoord_weather_event "
@@ -246,6 +280,7 @@ string generate_map_events_text(Json map_data) {
                      << json_to_string(coord_event, "y") << ", "
                      << json_to_string(coord_event, "elevation") << ", "
                      << json_to_string(coord_event, "weather") << "\n";
+                coords.push_back(coord_event);
             }
         }
         text << "\n";
@@ -264,6 +299,7 @@ string generate_map_events_text(Json map_data) {
                      << json_to_string(bg_event, "elevation") << ", "
                      << json_to_string(bg_event, "player_facing_dir") << ", "
                      << json_to_string(bg_event, "script") << "\n";
+                bgs.push_back(bg_event);
             }
             else if (bg_event["type"] == "hidden_item") {
                 text << "\tbg_hidden_item_event "
@@ -272,6 +308,7 @@ string generate_map_events_text(Json map_data) {
                      << json_to_string(bg_event, "elevation") << ", "
                      << json_to_string(bg_event, "item") << ", "
                      << json_to_string(bg_event, "flag") << "\n";
+                bgs.push_back(bg_event);
             }
             else if (bg_event["type"] == "secret_base") {
                 text << "\tbg_secret_base_event "
@@ -279,6 +316,7 @@ string generate_map_events_text(Json map_data) {
                      << json_to_string(bg_event, "y") << ", "
                      << json_to_string(bg_event, "elevation") << ", "
                      << json_to_string(bg_event, "secret_base_id") << "\n";
+                bgs.push_back(bg_event);
             }
         }
         text << "\n";
@@ -286,9 +324,19 @@ string generate_map_events_text(Json map_data) {
         bgs_label = "0x0";
     }
 
-    text << mapName << "_MapEvents::\n"
+    string warps_order_label = "0x0", coords_order_label = "0x0", bgs_order_label = "0x0";
+    if (!warps.empty())
+        warps_order_label = generate_event_order_text(warps, mapName + "_MapWarpsByPosition", text);
+    if (!coords.empty())
+        coords_order_label = generate_event_order_text(coords, mapName + "_MapCoordEventsByPosition", text);
+    if (!bgs.empty())
+        bgs_order_label = generate_event_order_text(bgs, mapName + "_MapBGEventsByPosition", text);
+
+    text << "\t.align 2\n"
+         << mapName << "_MapEvents::\n"
          << "\tmap_events " << objects_label << ", " << warps_label << ", "
-         << coords_label << ", " << bgs_label << "\n\n";
+         << coords_label << ", " << bgs_label << ", "
+         << warps_order_label << ", " << coords_order_label << ", " << bgs_order_label << "\n\n";
 
     return text.str();
 }
@@ -0,0 +1,546 @@
+// objcache - content-addressed object cache for the C build pipeline.
+//
+// The Makefile pipes each preprocessed (and preproc'd) translation unit into
+// objcache along with the command that compiles and assembles it. objcache
+// hashes the translation unit together with that command, the working
+// directory and the identity of the compiler binaries. If an object with the
+// same hash is already in the cache directory it is copied to the output path
+// and the command is never run. Otherwise the command is run with the
+// translation unit on its stdin and the object it produces is added to the
+// cache.
+//
+// Each lookup is logged to a stats file in the cache directory; "objcache -s"
+// prints and clears the hit/miss counts at the end of the build.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define MakeDir(path) _mkdir(path)
+#define GetPid() _getpid()
+#define getcwd _getcwd
+#define popen _popen
+#define pclose _pclose
+#define PATH_LIST_SEPARATOR ';'
+#else
+#include <unistd.h>
+#include <sys/wait.h>
+#define MakeDir(path) mkdir(path, 0777)
+#define GetPid() getpid()
+#define PATH_LIST_SEPARATOR ':'
+#endif
+
+#ifdef _MSC_VER
+
+#define FATAL_ERROR(format, ...)          \
+do                                        \
+{                                         \
+    fprintf(stderr, format, __VA_ARGS__); \
+    exit(1);                              \
+} while (0)
+
+#else
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#endif // _MSC_VER
+
+// Bump this whenever the hash inputs change so that old entries are ignored.
+#define CACHE_VERSION "objcache-1"
+
+#define MAX_IDENTITIES 8
+#define MAX_PATH_LENGTH 4096
+
+#define STATS_HIT  'H'
+#define STATS_MISS 'M'
+
+// SHA-1, used only as a content hash.
+
+struct Sha1
+{
+    uint32_t state[5];
+    uint64_t length;
+    unsigned char block[64];
+    int blockLength;
+};
+
+static uint32_t Rotl32(uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+static void Sha1ProcessBlock(struct Sha1 *sha, const unsigned char *block)
+{
+    uint32_t w[80];
+    uint32_t a, b, c, d, e;
+
+    for (int i = 0; i < 16; i++)
+        w[i] = ((uint32_t)block[i * 4] << 24)
+             | ((uint32_t)block[i * 4 + 1] << 16)
+             | ((uint32_t)block[i * 4 + 2] << 8)
+             | block[i * 4 + 3];
+
+    for (int i = 16; i < 80; i++)
+        w[i] = Rotl32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+    a = sha->state[0];
+    b = sha->state[1];
+    c = sha->state[2];
+    d = sha->state[3];
+    e = sha->state[4];
+
+    for (int i = 0; i < 80; i++)
+    {
+        uint32_t f, k, temp;
+
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+
+        temp = Rotl32(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = Rotl32(b, 30);
+        b = a;
+        a = temp;
+    }
+
+    sha->state[0] += a;
+    sha->state[1] += b;
+    sha->state[2] += c;
+    sha->state[3] += d;
+    sha->state[4] += e;
+}
+
+static void Sha1Init(struct Sha1 *sha)
+{
+    sha->state[0] = 0x67452301;
+    sha->state[1] = 0xEFCDAB89;
+    sha->state[2] = 0x98BADCFE;
+    sha->state[3] = 0x10325476;
+    sha->state[4] = 0xC3D2E1F0;
+    sha->length = 0;
+    sha->blockLength = 0;
+}
+
+static void Sha1Update(struct Sha1 *sha, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+
+    sha->length += size;
+
+    while (size > 0)
+    {
+        size_t count = 64 - sha->blockLength;
+
+        if (count > size)
+            count = size;
+
+        memcpy(sha->block + sha->blockLength, bytes, count);
+        sha->blockLength += count;
+        bytes += count;
+        size -= count;
+
+        if (sha->blockLength == 64)
+        {
+            Sha1ProcessBlock(sha, sha->block);
+            sha->blockLength = 0;
+        }
+    }
+}
+
+static void Sha1Final(struct Sha1 *sha, char *hex)
+{
+    uint64_t bitLength = sha->length * 8;
+    unsigned char padding = 0x80;
+    unsigned char lengthBytes[8];
+
+    Sha1Update(sha, &padding, 1);
+    padding = 0;
+    while (sha->blockLength != 56)
+        Sha1Update(sha, &padding, 1);
+
+    for (int i = 0; i < 8; i++)
+        lengthBytes[i] = bitLength >> (56 - i * 8);
+    Sha1Update(sha, lengthBytes, 8);
+
+    for (int i = 0; i < 5; i++)
+        sprintf(hex + i * 8, "%08x", (unsigned)sha->state[i]);
+}
+
+// Hashes a string including its terminator so adjacent fields can't run together.
+static void Sha1UpdateString(struct Sha1 *sha, const char *s)
+{
+    Sha1Update(sha, s, strlen(s) + 1);
+}
+
+static unsigned char *ReadStdin(size_t *size)
+{
+    size_t capacity = 1 << 20;
+    unsigned char *buffer = malloc(capacity);
+
+    if (buffer == NULL)
+        FATAL_ERROR("Failed to allocate memory for reading stdin.\n");
+
+    *size = 0;
+
+    for (;;)
+    {
+        size_t count;
+
+        if (*size == capacity)
+        {
+            capacity *= 2;
+            buffer = realloc(buffer, capacity);
+            if (buffer == NULL)
+                FATAL_ERROR("Failed to allocate memory for reading stdin.\n");
+        }
+
+        count = fread(buffer + *size, 1, capacity - *size, stdin);
+        if (count == 0)
+            break;
+        *size += count;
+    }
+
+    if (ferror(stdin))
+        FATAL_ERROR("Failed to read stdin.\n");
+
+    return buffer;
+}
+
+// Resolves a program name the same way the shell would, so that tools found
+// through PATH (e.g. arm-none-eabi-as) can be identified too.
+static bool FindProgram(const char *name, char *path)
+{
+    struct stat st;
+    const char *dirs;
+
+    if (strchr(name, '/') != NULL || strchr(name, '\\') != NULL)
+    {
+        snprintf(path, MAX_PATH_LENGTH, "%s", name);
+        return stat(path, &st) == 0;
+    }
+
+    dirs = getenv("PATH");
+    while (dirs != NULL && *dirs != 0)
+    {
+        const char *end = strchr(dirs, PATH_LIST_SEPARATOR);
+        int length = end != NULL ? (int)(end - dirs) : (int)strlen(dirs);
+
+        snprintf(path, MAX_PATH_LENGTH, "%.*s/%s", length, dirs, name);
+        if (stat(path, &st) == 0)
+            return true;
+
+        dirs = end != NULL ? end + 1 : NULL;
+    }
+
+    return false;
+}
+
+// Compiler binaries are identified by path, size and modification time rather
+// than by content, since the modern cc1 is tens of megabytes.
+static void HashIdentity(struct Sha1 *sha, const char *name)
+{
+    char path[MAX_PATH_LENGTH];
+    char buffer[64];
+    struct stat st;
+
+    if (!FindProgram(name, path) || stat(path, &st) != 0)
+        FATAL_ERROR("Failed to find \"%s\".\n", name);
+
+    Sha1UpdateString(sha, path);
+    snprintf(buffer, sizeof(buffer), "%lld:%lld", (long long)st.st_size, (long long)st.st_mtime);
+    Sha1UpdateString(sha, buffer);
+}
+
+static void MakeDirs(const char *path)
+{
+    char buffer[MAX_PATH_LENGTH];
+
+    snprintf(buffer, sizeof(buffer), "%s", path);
+
+    for (char *p = buffer + 1; *p != 0; p++)
+    {
+        if (*p == '/')
+        {
+            *p = 0;
+            MakeDir(buffer);
+            *p = '/';
+        }
+    }
+
+    MakeDir(buffer);
+}
+
+static bool CopyFile(const char *srcPath, const char *destPath)
+{
+    FILE *src = fopen(srcPath, "rb");
+    FILE *dest;
+    char buffer[0x10000];
+    size_t count;
+    bool success = true;
+
+    if (src == NULL)
+        return false;
+
+    dest = fopen(destPath, "wb");
+    if (dest == NULL)
+    {
+        fclose(src);
+        return false;
+    }
+
+    while ((count = fread(buffer, 1, sizeof(buffer), src)) != 0)
+    {
+        if (fwrite(buffer, 1, count, dest) != count)
+        {
+            success = false;
+            break;
+        }
+    }
+
+    if (ferror(src))
+        success = false;
+
+    fclose(src);
+    if (fclose(dest) != 0)
+        success = false;
+
+    return success;
+}
+
+// Stores the object under a temporary name first so that parallel jobs never
+// see a partially written cache entry.
+static void StoreObject(const char *objectPath, const char *cachePath, const char *cacheDir)
+{
+    char tempPath[MAX_PATH_LENGTH + 128];
+
+    MakeDirs(cacheDir);
+    snprintf(tempPath, sizeof(tempPath), "%s.%d.tmp", cachePath, (int)GetPid());
+
+    if (CopyFile(objectPath, tempPath))
+    {
+        remove(cachePath);
+        if (rename(tempPath, cachePath) == 0)
+            return;
+    }
+
+    remove(tempPath);
+}
+
+// A single byte per lookup; appends this small are atomic, so concurrent jobs
+// don't need any locking.
+static void LogLookup(const char *dir, char result)
+{
+    char path[MAX_PATH_LENGTH];
+    FILE *fp;
+
+    snprintf(path, sizeof(path), "%s/stats", dir);
+    fp = fopen(path, "ab");
+    if (fp == NULL)
+        return;
+
+    fputc(result, fp);
+    fclose(fp);
+}
+
+static int PrintStats(const char *dir)
+{
+    char path[MAX_PATH_LENGTH];
+    FILE *fp;
+    int hits = 0;
+    int misses = 0;
+    int c;
+
+    snprintf(path, sizeof(path), "%s/stats", dir);
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+        return 0;
+
+    while ((c = fgetc(fp)) != EOF)
+    {
+        if (c == STATS_HIT)
+            hits++;
+        else if (c == STATS_MISS)
+            misses++;
+    }
+
+    fclose(fp);
+    remove(path);
+
+    if (hits + misses != 0)
+        printf("objcache: %d hits, %d misses (%d%% hit rate)\n", hits, misses, hits * 100 / (hits + misses));
+
+    return 0;
+}
+
+static int RunCommand(const char *command, const unsigned char *input, size_t inputSize)
+{
+    FILE *pipe = popen(command, "w");
+    int status;
+
+    if (pipe == NULL)
+        FATAL_ERROR("Failed to run \"%s\".\n", command);
+
+    fwrite(input, 1, inputSize, pipe);
+    status = pclose(pipe);
+
+    if (status == -1)
+        return 1;
+#ifndef _WIN32
+    if (WIFEXITED(status))
+        return WEXITSTATUS(status);
+    return 1;
+#else
+    return status;
+#endif
+}
+
+static void Usage(void)
+{
+    FATAL_ERROR("Usage: objcache -d CACHE_DIR [-i PROGRAM]... -o OBJECT -c COMMAND\n"
+                "       objcache -d CACHE_DIR -s\n"
+                "\n"
+                "Reads a translation unit from stdin. On a cache hit, restores OBJECT from\n"
+                "CACHE_DIR. Otherwise runs COMMAND with the translation unit as its stdin\n"
+                "and caches the OBJECT it writes. Each PROGRAM's path, size and mtime are\n"
+                "part of the hash. -s prints and clears the hit/miss counts.\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *cacheDir = NULL;
+    const char *objectPath = NULL;
+    const char *command = NULL;
+    const char *identities[MAX_IDENTITIES];
+    int identityCount = 0;
+    bool printStats = false;
+    struct Sha1 sha;
+    char hash[41];
+    char cwd[MAX_PATH_LENGTH];
+    char entryDir[MAX_PATH_LENGTH];
+    char entryPath[MAX_PATH_LENGTH + 64];
+    unsigned char *input;
+    size_t inputSize;
+    int status;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *option = argv[i];
+
+        if (strcmp(option, "-s") == 0)
+        {
+            printStats = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            Usage();
+
+        if (strcmp(option, "-d") == 0)
+        {
+            cacheDir = argv[++i];
+        }
+        else if (strcmp(option, "-o") == 0)
+        {
+            objectPath = argv[++i];
+        }
+        else if (strcmp(option, "-c") == 0)
+        {
+            command = argv[++i];
+        }
+        else if (strcmp(option, "-i") == 0)
+        {
+            if (identityCount == MAX_IDENTITIES)
+                FATAL_ERROR("Too many -i options.\n");
+            identities[identityCount++] = argv[++i];
+        }
+        else
+        {
+            Usage();
+        }
+    }
+
+    if (cacheDir == NULL)
+        Usage();
+
+    if (printStats)
+        return PrintStats(cacheDir);
+
+    if (objectPath == NULL || command == NULL)
+        Usage();
+
+#ifdef SIGPIPE
+    // Let a failing command surface through its exit status instead.
+    signal(SIGPIPE, SIG_IGN);
+#endif
+
+    input = ReadStdin(&inputSize);
+
+    // Debug info records the working directory, so it's part of the key too.
+    if (getcwd(cwd, sizeof(cwd)) == NULL)
+        FATAL_ERROR("Failed to get the working directory.\n");
+
+    Sha1Init(&sha);
+    Sha1UpdateString(&sha, CACHE_VERSION);
+    Sha1UpdateString(&sha, command);
+    Sha1UpdateString(&sha, cwd);
+    for (int i = 0; i < identityCount; i++)
+        HashIdentity(&sha, identities[i]);
+    Sha1Update(&sha, input, inputSize);
+    Sha1Final(&sha, hash);
+
+    snprintf(entryDir, sizeof(entryDir), "%s/%.2s", cacheDir, hash);
+    snprintf(entryPath, sizeof(entryPath), "%s/%s.o", entryDir, hash + 2);
+
+    MakeDirs(cacheDir);
+
+    if (CopyFile(entryPath, objectPath))
+    {
+        LogLookup(cacheDir, STATS_HIT);
+        free(input);
+        return 0;
+    }
+
+    status = RunCommand(command, input, inputSize);
+    free(input);
+
+    if (status != 0)
+        return status;
+
+    StoreObject(objectPath, entryPath, entryDir);
+    LogLookup(cacheDir, STATS_MISS);
+
+    return 0;
+}
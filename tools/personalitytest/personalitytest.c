@@ -0,0 +1,189 @@
+// personalitytest - checks GeneratePersonality against rejection sampling.
+//
+// GeneratePersonality in src/pokemon_personality.inc.c builds a personality
+// value with the requested nature, gender, Unown letter and shininess
+// directly, instead of drawing Random32() until one matches. This tool
+// compiles that file and src/random.c for the host, runs the builder and a
+// rejection sampler for a set of constraint combinations, and checks that:
+//
+//   - every generated value meets its constraints, and
+//   - the generated values are distributed like the rejection sampler's, by a
+//     two-sample chi-square test on several 6-bit fields of the value.
+//
+// It exits with a non-zero status if any check fails.
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "global.h"
+#include "pokemon.h"
+#include "random.h"
+
+// Only the gender ratios of the species used below are read.
+const struct SpeciesInfo gSpeciesInfo[NUM_SPECIES] =
+{
+    [SPECIES_BULBASAUR] = { .genderRatio = 31 },
+    [SPECIES_PIKACHU]   = { .genderRatio = 127 },
+    [SPECIES_CLEFAIRY]  = { .genderRatio = 191 },
+    [SPECIES_UNOWN]     = { .genderRatio = MON_GENDERLESS },
+};
+
+// The constraints are checked against these rather than the builder's
+// shortcuts, so they are defined here as plainly as possible.
+u8 GetNatureFromPersonality(u32 personality)
+{
+    return personality % NUM_NATURES;
+}
+
+static u8 GetGenderFromRatioAndPersonality(u32 genderRatio, u32 personality)
+{
+    switch (genderRatio)
+    {
+    case MON_MALE:
+    case MON_FEMALE:
+    case MON_GENDERLESS:
+        return genderRatio;
+    }
+
+    if (genderRatio > (personality & 0xFF))
+        return MON_FEMALE;
+    else
+        return MON_MALE;
+}
+
+#include "pokemon_personality.inc.c"
+
+struct TestCase
+{
+    const char *name;
+    u16 species;
+    u8 gender;
+    u8 nature;
+    u8 unownLetter;
+    u8 shininess;
+    u32 otId;
+    u32 samples;
+};
+
+static bool32 MeetsConstraints(const struct TestCase *test, u32 personality)
+{
+    if (test->nature < NUM_NATURES && GetNatureFromPersonality(personality) != test->nature)
+        return FALSE;
+    if (test->gender != MON_GENDERLESS && GetGenderFromRatioAndPersonality(gSpeciesInfo[test->species].genderRatio, personality) != test->gender)
+        return FALSE;
+    if (test->unownLetter != 0 && GET_UNOWN_LETTER(personality) != (u32)test->unownLetter - 1)
+        return FALSE;
+    if (test->shininess == PERSONALITY_SHINY && GET_SHINY_VALUE(test->otId, personality) >= SHINY_ODDS)
+        return FALSE;
+    if (test->shininess == PERSONALITY_NOT_SHINY && GET_SHINY_VALUE(test->otId, personality) < SHINY_ODDS)
+        return FALSE;
+    return TRUE;
+}
+
+// What GeneratePersonality replaced.
+static u32 RejectionSample(const struct TestCase *test)
+{
+    u32 personality;
+
+    do
+    {
+        personality = Random32();
+    } while (!MeetsConstraints(test, personality));
+    return personality;
+}
+
+// The fields compared between the two samplers. These cover the bits that the
+// gender, letter and nature are built from, and the upper half that the shiny
+// path derives.
+static const u8 sFieldShifts[] = {0, 8, 10, 16, 24, 26};
+
+#define FIELD_BINS 64
+
+static const struct TestCase sTestCases[] =
+{
+    {"nature",                 SPECIES_PIKACHU,   MON_GENDERLESS, 7,           0,  PERSONALITY_SHINY_ANY, 0,          20000},
+    {"gender",                 SPECIES_BULBASAUR, MON_FEMALE,     NUM_NATURES, 0,  PERSONALITY_SHINY_ANY, 0,          20000},
+    {"gender and nature",      SPECIES_CLEFAIRY,  MON_MALE,       24,          0,  PERSONALITY_SHINY_ANY, 0,          20000},
+    {"letter",                 SPECIES_UNOWN,     MON_GENDERLESS, NUM_NATURES, 27, PERSONALITY_SHINY_ANY, 0,          20000},
+    {"letter, gender, nature", SPECIES_PIKACHU,   MON_FEMALE,     3,           5,  PERSONALITY_SHINY_ANY, 0,          20000},
+    {"not shiny",              SPECIES_PIKACHU,   MON_GENDERLESS, NUM_NATURES, 0,  PERSONALITY_NOT_SHINY, 0x1234ABCD, 20000},
+    {"shiny",                  SPECIES_PIKACHU,   MON_GENDERLESS, NUM_NATURES, 0,  PERSONALITY_SHINY,     0x1234ABCD, 20000},
+    {"shiny and nature",       SPECIES_PIKACHU,   MON_GENDERLESS, 12,          0,  PERSONALITY_SHINY,     0x1234ABCD, 1000},
+};
+
+static bool32 RunTest(const struct TestCase *test)
+{
+    static u32 built[ARRAY_COUNT(sFieldShifts)][FIELD_BINS];
+    static u32 sampled[ARRAY_COUNT(sFieldShifts)][FIELD_BINS];
+    bool32 passed = TRUE;
+    u32 i, j;
+
+    memset(built, 0, sizeof(built));
+    memset(sampled, 0, sizeof(sampled));
+
+    for (i = 0; i < test->samples; i++)
+    {
+        u32 personality = GeneratePersonality(test->species, test->gender, test->nature, test->unownLetter, test->shininess, test->otId);
+        u32 reference = RejectionSample(test);
+
+        if (!MeetsConstraints(test, personality))
+        {
+            printf("FAIL %s: 0x%08X doesn't meet its constraints\n", test->name, personality);
+            return FALSE;
+        }
+        for (j = 0; j < ARRAY_COUNT(sFieldShifts); j++)
+        {
+            built[j][(personality >> sFieldShifts[j]) % FIELD_BINS]++;
+            sampled[j][(reference >> sFieldShifts[j]) % FIELD_BINS]++;
+        }
+    }
+
+    // Both samples are the same size, so the statistic for whether they come
+    // from the same distribution is the sum of (a - b)^2 / (a + b).
+    for (j = 0; j < ARRAY_COUNT(sFieldShifts); j++)
+    {
+        double chiSquare = 0;
+        double limit;
+        u32 bins = 0;
+
+        for (i = 0; i < FIELD_BINS; i++)
+        {
+            double a = built[j][i], b = sampled[j][i];
+
+            if (a + b == 0)
+                continue;
+            chiSquare += (a - b) * (a - b) / (a + b);
+            bins++;
+        }
+        if (bins < 2)
+            continue;
+
+        // Well past where a matching distribution would land
+        limit = (bins - 1) + 5 * sqrt(2.0 * (bins - 1));
+        if (chiSquare > limit)
+        {
+            printf("FAIL %s: bits %u-%u chi-square %.1f over %u bins (limit %.1f)\n",
+                   test->name, sFieldShifts[j], sFieldShifts[j] + 5, chiSquare, bins, limit);
+            passed = FALSE;
+        }
+    }
+
+    if (passed)
+        printf("ok   %s\n", test->name);
+    return passed;
+}
+
+int main(void)
+{
+    bool32 passed = TRUE;
+    u32 i;
+
+    SeedRng(0x5EED);
+    for (i = 0; i < ARRAY_COUNT(sTestCases); i++)
+    {
+        if (!RunTest(&sTestCases[i]))
+            passed = FALSE;
+    }
+
+    return passed ? 0 : 1;
+}
@@ -507,7 +507,8 @@ void AsmFile::OutputLine()
         if (m_pos >= m_size)
         {
             RaiseWarning("file doesn't end with newline");
-            puts(&m_buffer[m_lineStart]);
+            g_output.String(&m_buffer[m_lineStart]);
+            g_output.Char('\n');
         }
         else
         {
@@ -517,7 +518,8 @@ void AsmFile::OutputLine()
     else
     {
         m_buffer[m_pos] = 0;
-        puts(&m_buffer[m_lineStart]);
+        g_output.String(&m_buffer[m_lineStart]);
+        g_output.Char('\n');
         m_buffer[m_pos] = '\n';
         m_pos++;
         m_lineStart = m_pos;
@@ -564,7 +566,7 @@ bool AsmFile::IsAtEnd()
 // Output the current location to set gas's logical file and line numbers.
 void AsmFile::OutputLocation()
 {
-    std::printf("# %ld \"%s\"\n", m_lineNum, m_filename.c_str());
+    g_output.Format("# %ld \"%s\"\n", m_lineNum, m_filename.c_str());
 }
 
 // Reports a diagnostic message.
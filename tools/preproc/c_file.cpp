@@ -112,21 +112,21 @@ void CFile::Preproc()
         {
             if (m_buffer[m_pos] == stringChar)
             {
-                std::putchar(stringChar);
+                g_output.Char(stringChar);
                 m_pos++;
                 stringChar = 0;
             }
             else if (m_buffer[m_pos] == '\\' && m_buffer[m_pos + 1] == stringChar)
             {
-                std::putchar('\\');
-                std::putchar(stringChar);
+                g_output.Char('\\');
+                g_output.Char(stringChar);
                 m_pos += 2;
             }
             else
             {
                 if (m_buffer[m_pos] == '\n')
                     m_lineNum++;
-                std::putchar(m_buffer[m_pos]);
+                g_output.Char(m_buffer[m_pos]);
                 m_pos++;
             }
         }
@@ -140,7 +140,7 @@ void CFile::Preproc()
 
             char c = m_buffer[m_pos++];
 
-            std::putchar(c);
+            g_output.Char(c);
 
             if (c == '\n')
                 m_lineNum++;
@@ -169,7 +169,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos += 2;
         m_lineNum++;
-        std::putchar('\n');
+        g_output.Char('\n');
         return true;
     }
 
@@ -177,7 +177,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos++;
         m_lineNum++;
-        std::putchar('\n');
+        g_output.Char('\n');
         return true;
     }
 
@@ -220,7 +220,7 @@ void CFile::TryConvertString()
 
     SkipWhitespace();
 
-    std::printf("{ ");
+    g_output.String("{ ");
 
     while (1)
     {
@@ -242,7 +242,10 @@ void CFile::TryConvertString()
             }
 
             for (int i = 0; i < length; i++)
-                printf("0x%02X, ", s[i]);
+            {
+                g_output.HexByte(s[i]);
+                g_output.String(", ");
+            }
         }
         else if (m_buffer[m_pos] == ')')
         {
@@ -261,9 +264,9 @@ void CFile::TryConvertString()
     }
 
     if (noTerminator)
-        std::printf(" }");
+        g_output.String(" }");
     else
-        std::printf("0xFF }");
+        g_output.String("0xFF }");
 }
 
 bool CFile::CheckIdentifier(const std::string& ident)
@@ -321,9 +324,12 @@ int ExtractData(const std::unique_ptr<unsigned char[]>& buffer, int offset, int
 
 void CFile::TryConvertIncbin()
 {
-    std::string idents[6] = { "INCBIN_S8", "INCBIN_U8", "INCBIN_S16", "INCBIN_U16", "INCBIN_S32", "INCBIN_U32" };
+    static const std::string idents[6] = { "INCBIN_S8", "INCBIN_U8", "INCBIN_S16", "INCBIN_U16", "INCBIN_S32", "INCBIN_U32" };
     int incbinType = -1;
 
+    if (m_buffer[m_pos] != 'I')
+        return;
+
     for (int i = 0; i < 6; i++)
     {
         if (CheckIdentifier(idents[i]))
@@ -355,7 +361,7 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("{");
+    g_output.Char('{');
 
     while (true)
     {
@@ -406,9 +412,9 @@ void CFile::TryConvertIncbin()
             offset += size;
 
             if (isSigned)
-                std::printf("%d,", data);
+                g_output.Format("%d,", data);
             else
-                std::printf("%uu,", data);
+                g_output.Format("%uu,", data);
         }
 
         SkipWhitespace();
@@ -424,7 +430,7 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("}");
+    g_output.Char('}');
 }
 
 // Reports a diagnostic message.
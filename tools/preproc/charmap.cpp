@@ -21,6 +21,14 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdarg>
+#include <string>
+#ifdef _WIN32
+#include <process.h>
+#define GetPid() _getpid()
+#else
+#include <unistd.h>
+#define GetPid() getpid()
+#endif
 #include "preproc.h"
 #include "charmap.h"
 #include "char_util.h"
@@ -369,7 +377,131 @@ void CharmapReader::SkipWhitespace()
         m_pos++;
 }
 
-Charmap::Charmap(std::string filename)
+// The parsed charmap is cached in a compiled form next to the text charmap
+// ("charmap.txt.bin"), since every preproc run would otherwise parse it again.
+// The cache records a hash of the text charmap and is rebuilt when it changes.
+static const char kCompiledCharmapMagic[4] = { 'P', 'C', 'M', '1' };
+
+static std::uint64_t Fnv1aHash(const unsigned char *data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325)
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001B3;
+    }
+
+    return hash;
+}
+
+static std::string ReadWholeFile(const std::string& filename)
+{
+    FILE *fp = std::fopen(filename.c_str(), "rb");
+
+    if (fp == NULL)
+        return std::string();
+
+    std::string contents;
+    char buffer[0x4000];
+    std::size_t size;
+
+    while ((size = std::fread(buffer, 1, sizeof(buffer), fp)) != 0)
+        contents.append(buffer, size);
+
+    std::fclose(fp);
+
+    return contents;
+}
+
+static void Write32(std::string& out, std::uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        out += (char)(value >> (i * 8));
+}
+
+static void Write64(std::string& out, std::uint64_t value)
+{
+    Write32(out, (std::uint32_t)value);
+    Write32(out, (std::uint32_t)(value >> 32));
+}
+
+class CompiledCharmapReader
+{
+public:
+    CompiledCharmapReader(const std::string& data) : m_data(data), m_pos(0), m_ok(true) {}
+
+    bool Ok() const { return m_ok; }
+    bool AtEnd() const { return m_pos == m_data.size(); }
+
+    std::uint32_t Read32()
+    {
+        if (m_pos + 4 > m_data.size())
+        {
+            m_ok = false;
+            return 0;
+        }
+
+        std::uint32_t value = 0;
+
+        for (int i = 0; i < 4; i++)
+            value |= (std::uint32_t)(unsigned char)m_data[m_pos++] << (i * 8);
+
+        return value;
+    }
+
+    std::uint64_t Read64()
+    {
+        std::uint64_t low = Read32();
+        return low | ((std::uint64_t)Read32() << 32);
+    }
+
+    std::string_view ReadBytes(std::uint32_t length)
+    {
+        if (length > m_data.size() - m_pos)
+        {
+            m_ok = false;
+            return std::string_view();
+        }
+
+        std::string_view bytes(m_data.data() + m_pos, length);
+        m_pos += length;
+        return bytes;
+    }
+
+private:
+    const std::string& m_data;
+    std::size_t m_pos;
+    bool m_ok;
+};
+
+Charmap::Charmap(std::string filename) : m_charTable(kCharTableSize, SequenceRef{ 0, 0 }), m_escapes()
+{
+    std::string text = ReadWholeFile(filename);
+    std::uint64_t hash = Fnv1aHash((const unsigned char *)text.data(), text.size());
+    std::string compiledFilename = filename + ".bin";
+
+    if (LoadCompiled(compiledFilename, hash))
+        return;
+
+    Parse(filename);
+    SaveCompiled(compiledFilename, hash);
+}
+
+Charmap::SequenceRef Charmap::AddSequence(std::string_view sequence)
+{
+    SequenceRef ref = { (std::uint32_t)m_sequences.size(), (std::uint32_t)sequence.size() };
+    m_sequences.append(sequence.data(), sequence.size());
+    return ref;
+}
+
+void Charmap::SetChar(std::int32_t code, SequenceRef ref)
+{
+    if (code >= 0 && code < kCharTableSize)
+        m_charTable[code] = ref;
+    else
+        m_wideChars[code] = ref;
+}
+
+void Charmap::Parse(const std::string& filename)
 {
     CharmapReader reader(filename);
 
@@ -387,22 +519,151 @@ Charmap::Charmap(std::string filename)
         switch (lhs.type)
         {
         case LhsType::Char:
-            if (m_chars.find(lhs.code) != m_chars.end())
+            if (Char(lhs.code).length() != 0)
                 reader.RaiseError("redefining char");
-            m_chars[lhs.code] = sequence;
+            SetChar(lhs.code, AddSequence(sequence));
             break;
         case LhsType::Escape:
-            if (m_escapes[lhs.code].length() != 0)
+            if (m_escapes[lhs.code].length != 0)
                 reader.RaiseError("redefining escape");
-            m_escapes[lhs.code] = sequence;
+            m_escapes[lhs.code] = AddSequence(sequence);
             break;
         case LhsType::Constant:
             if (m_constants.find(lhs.name) != m_constants.end())
                 reader.RaiseError("redefining constant");
-            m_constants[lhs.name] = sequence;
+            m_constants[lhs.name] = AddSequence(sequence);
             break;
         }
 
         reader.ExpectEmptyRestOfLine();
     }
 }
+
+// Loads the compiled charmap if it exists and was made from the same text charmap.
+bool Charmap::LoadCompiled(const std::string& filename, std::uint64_t hash)
+{
+    std::string data = ReadWholeFile(filename);
+
+    if (data.size() < 20 || data.compare(0, 4, kCompiledCharmapMagic, 4) != 0)
+        return false;
+
+    CompiledCharmapReader reader(data);
+    reader.ReadBytes(4);
+
+    if (reader.Read64() != hash)
+        return false;
+
+    // Guards against a cache that another preproc was still writing.
+    std::uint64_t payloadHash = reader.Read64();
+
+    if (Fnv1aHash((const unsigned char *)data.data() + 20, data.size() - 20) != payloadHash)
+        return false;
+
+    std::string_view sequences = reader.ReadBytes(reader.Read32());
+    bool valid = reader.Ok();
+    auto readRef = [&]() {
+        SequenceRef ref = { reader.Read32(), reader.Read32() };
+        if (ref.offset > sequences.size() || ref.length > sequences.size() - ref.offset)
+            valid = false;
+        return ref;
+    };
+
+    std::uint32_t numChars = reader.Read32();
+
+    for (std::uint32_t i = 0; i < numChars && valid && reader.Ok(); i++)
+    {
+        std::int32_t code = (std::int32_t)reader.Read32();
+        SetChar(code, readRef());
+    }
+
+    for (int i = 0; i < 128; i++)
+        m_escapes[i] = readRef();
+
+    std::uint32_t numConstants = reader.Read32();
+
+    for (std::uint32_t i = 0; i < numConstants && valid && reader.Ok(); i++)
+    {
+        std::string_view name = reader.ReadBytes(reader.Read32());
+        m_constants[std::string(name)] = readRef();
+    }
+
+    if (!valid || !reader.Ok() || !reader.AtEnd())
+    {
+        m_charTable.assign(kCharTableSize, SequenceRef{ 0, 0 });
+        m_wideChars.clear();
+        for (int i = 0; i < 128; i++)
+            m_escapes[i] = { 0, 0 };
+        m_constants.clear();
+        return false;
+    }
+
+    m_sequences.assign(sequences.data(), sequences.size());
+    return true;
+}
+
+// Writes the compiled charmap. Failing to do so isn't an error, since it's only a cache.
+void Charmap::SaveCompiled(const std::string& filename, std::uint64_t hash)
+{
+    std::string payload;
+
+    Write32(payload, m_sequences.size());
+    payload += m_sequences;
+
+    std::uint32_t numChars = m_wideChars.size();
+
+    for (std::int32_t code = 0; code < kCharTableSize; code++)
+        if (m_charTable[code].length != 0)
+            numChars++;
+
+    Write32(payload, numChars);
+
+    for (std::int32_t code = 0; code < kCharTableSize; code++)
+    {
+        if (m_charTable[code].length != 0)
+        {
+            Write32(payload, code);
+            Write32(payload, m_charTable[code].offset);
+            Write32(payload, m_charTable[code].length);
+        }
+    }
+
+    for (const auto& wideChar : m_wideChars)
+    {
+        Write32(payload, wideChar.first);
+        Write32(payload, wideChar.second.offset);
+        Write32(payload, wideChar.second.length);
+    }
+
+    for (int i = 0; i < 128; i++)
+    {
+        Write32(payload, m_escapes[i].offset);
+        Write32(payload, m_escapes[i].length);
+    }
+
+    Write32(payload, m_constants.size());
+
+    for (const auto& constant : m_constants)
+    {
+        Write32(payload, constant.first.size());
+        payload += constant.first;
+        Write32(payload, constant.second.offset);
+        Write32(payload, constant.second.length);
+    }
+
+    std::string data(kCompiledCharmapMagic, 4);
+    Write64(data, hash);
+    Write64(data, Fnv1aHash((const unsigned char *)payload.data(), payload.size()));
+    data += payload;
+
+    // Write to a temporary file first so that other preproc processes never see a partial cache.
+    std::string tempFilename = filename + "." + std::to_string(GetPid()) + ".tmp";
+    FILE *fp = std::fopen(tempFilename.c_str(), "wb");
+
+    if (fp == NULL)
+        return;
+
+    bool written = std::fwrite(data.data(), data.size(), 1, fp) == 1;
+
+    if (std::fclose(fp) != 0 || !written || std::rename(tempFilename.c_str(), filename.c_str()) != 0)
+        std::remove(tempFilename.c_str());
+}
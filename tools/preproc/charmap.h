@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
 
@@ -31,34 +32,59 @@ class Charmap
 public:
     Charmap(std::string filename);
 
-    std::string Char(std::int32_t code)
+    std::string_view Char(std::int32_t code) const
     {
-        auto it = m_chars.find(code);
+        if (code >= 0 && code < kCharTableSize)
+            return Sequence(m_charTable[code]);
 
-        if (it == m_chars.end())
-            return std::string();
+        auto it = m_wideChars.find(code);
 
-        return it->second;
+        if (it == m_wideChars.end())
+            return std::string_view();
+
+        return Sequence(it->second);
     }
 
-    std::string Escape(unsigned char code)
+    std::string_view Escape(unsigned char code) const
     {
-        return m_escapes[code];
+        return Sequence(m_escapes[code]);
     }
 
-    std::string Constant(std::string identifier)
+    std::string_view Constant(std::string_view identifier) const
     {
         auto it = m_constants.find(identifier);
 
         if (it == m_constants.end())
-            return std::string();
+            return std::string_view();
 
-        return it->second;
+        return Sequence(it->second);
     }
 private:
-    std::map<std::int32_t, std::string> m_chars;
-    std::string m_escapes[128];
-    std::map<std::string, std::string> m_constants;
+    // All sequences are kept in m_sequences. An empty ref means no mapping.
+    struct SequenceRef
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    static const std::int32_t kCharTableSize = 0x10000;
+
+    std::string m_sequences;
+    std::vector<SequenceRef> m_charTable;
+    std::map<std::int32_t, SequenceRef> m_wideChars;
+    SequenceRef m_escapes[128];
+    std::map<std::string, SequenceRef, std::less<>> m_constants;
+
+    std::string_view Sequence(SequenceRef ref) const
+    {
+        return std::string_view(m_sequences.data() + ref.offset, ref.length);
+    }
+
+    SequenceRef AddSequence(std::string_view sequence);
+    void SetChar(std::int32_t code, SequenceRef ref);
+    void Parse(const std::string& filename);
+    bool LoadCompiled(const std::string& filename, std::uint64_t hash);
+    void SaveCompiled(const std::string& filename, std::uint64_t hash);
 };
 
 #endif // CHARMAP_H
@@ -18,6 +18,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <cstdarg>
 #include <string>
 #include <stack>
 #include "preproc.h"
@@ -26,20 +27,82 @@
 #include "charmap.h"
 
 Charmap* g_charmap;
+OutputBuffer g_output;
+
+void OutputBuffer::String(const char* s, std::size_t length)
+{
+    if (length > kSize - m_length)
+    {
+        Flush();
+
+        if (length > kSize)
+        {
+            std::fwrite(s, 1, length, stdout);
+            return;
+        }
+    }
+
+    std::memcpy(&m_buffer[m_length], s, length);
+    m_length += length;
+}
+
+// Writes a byte as "0xXX".
+void OutputBuffer::HexByte(unsigned char byte)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    char s[4] = { '0', 'x', digits[byte >> 4], digits[byte & 0xF] };
+
+    String(s, 4);
+}
+
+void OutputBuffer::Format(const char* format, ...)
+{
+    char buffer[1024];
+    std::va_list args;
+
+    va_start(args, format);
+    int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (length < 0)
+        FATAL_ERROR("Failed to format output.\n");
+
+    if ((std::size_t)length >= sizeof(buffer))
+    {
+        std::string s(length, 0);
+
+        va_start(args, format);
+        std::vsnprintf(&s[0], length + 1, format, args);
+        va_end(args);
+        String(s.data(), length);
+    }
+    else
+    {
+        String(buffer, length);
+    }
+}
+
+void OutputBuffer::Flush()
+{
+    if (m_length != 0)
+        std::fwrite(m_buffer, 1, m_length, stdout);
+
+    m_length = 0;
+}
 
 void PrintAsmBytes(unsigned char *s, int length)
 {
     if (length > 0)
     {
-        std::printf("\t.byte ");
+        g_output.String("\t.byte ");
         for (int i = 0; i < length; i++)
         {
-            std::printf("0x%02X", s[i]);
+            g_output.HexByte(s[i]);
 
             if (i < length - 1)
-                std::printf(", ");
+                g_output.String(", ");
         }
-        std::putchar('\n');
+        g_output.Char('\n');
     }
 }
 
@@ -90,7 +153,7 @@ void PreprocAsmFile(std::string filename)
             if (globalLabel.length() != 0)
             {
                 const char *s = globalLabel.c_str();
-                std::printf("%s: ; .global %s\n", s, s);
+                g_output.Format("%s: ; .global %s\n", s, s);
             }
             else
             {
@@ -23,6 +23,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include "charmap.h"
 
 #ifdef _MSC_VER
@@ -51,4 +52,34 @@ const unsigned long kMaxCharmapSequenceLength = 16;
 
 extern Charmap* g_charmap;
 
+// Collects output and writes it to stdout in large blocks, since most of
+// it is produced a character or a byte at a time.
+class OutputBuffer
+{
+public:
+    ~OutputBuffer() { Flush(); }
+
+    void Char(char c)
+    {
+        if (m_length == kSize)
+            Flush();
+
+        m_buffer[m_length++] = c;
+    }
+
+    void String(const char* s, std::size_t length);
+    void String(const char* s) { String(s, std::strlen(s)); }
+    void HexByte(unsigned char byte);
+    void Format(const char* format, ...);
+    void Flush();
+
+private:
+    static const std::size_t kSize = 0x10000;
+
+    char m_buffer[kSize];
+    std::size_t m_length = 0;
+};
+
+extern OutputBuffer g_output;
+
 #endif // PREPROC_H
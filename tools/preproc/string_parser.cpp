@@ -27,9 +27,9 @@
 #include "utf8.h"
 
 // Reads a charmap char or escape sequence.
-std::string StringParser::ReadCharOrEscape()
+std::string_view StringParser::ReadCharOrEscape()
 {
-    std::string sequence;
+    std::string_view sequence;
 
     bool isEscape = (m_buffer[m_pos] == '\\');
 
@@ -93,11 +93,9 @@ std::string StringParser::ReadCharOrEscape()
     return sequence;
 }
 
-// Reads a charmap constant, i.e. "{FOO}".
-std::string StringParser::ReadBracketedConstants()
+// Reads a charmap constant, i.e. "{FOO}", and appends its sequence to the output.
+void StringParser::ReadBracketedConstants()
 {
-    std::string totalSequence;
-
     m_pos++; // Assume we're on the left curly bracket.
 
     while (m_buffer[m_pos] != '}')
@@ -113,7 +111,7 @@ std::string StringParser::ReadBracketedConstants()
             while (IsIdentifierChar(m_buffer[m_pos]))
                 m_pos++;
 
-            std::string sequence = g_charmap->Constant(std::string(&m_buffer[startPos], m_pos - startPos));
+            std::string_view sequence = g_charmap->Constant(std::string_view(&m_buffer[startPos], m_pos - startPos));
 
             if (sequence.length() == 0)
             {
@@ -121,7 +119,7 @@ std::string StringParser::ReadBracketedConstants()
                 RaiseError("unknown constant '%s'", &m_buffer[startPos]);
             }
 
-            totalSequence += sequence;
+            AppendSequence(sequence);
         }
         else if (IsAsciiDigit(m_buffer[m_pos]))
         {
@@ -130,17 +128,17 @@ std::string StringParser::ReadBracketedConstants()
             switch (integer.size)
             {
             case 1:
-                totalSequence += (unsigned char)integer.value;
+                AppendByte(integer.value);
                 break;
             case 2:
-                totalSequence += (unsigned char)integer.value;
-                totalSequence += (unsigned char)(integer.value >> 8);
+                AppendByte(integer.value);
+                AppendByte(integer.value >> 8);
                 break;
             case 4:
-                totalSequence += (unsigned char)integer.value;
-                totalSequence += (unsigned char)(integer.value >> 8);
-                totalSequence += (unsigned char)(integer.value >> 16);
-                totalSequence += (unsigned char)(integer.value >> 24);
+                AppendByte(integer.value);
+                AppendByte(integer.value >> 8);
+                AppendByte(integer.value >> 16);
+                AppendByte(integer.value >> 24);
                 break;
             }
         }
@@ -161,8 +159,23 @@ std::string StringParser::ReadBracketedConstants()
     }
 
     m_pos++; // Go past the right curly bracket.
+}
+
+void StringParser::AppendByte(unsigned char byte)
+{
+    if (m_destLength == kMaxStringLength)
+        RaiseError("mapped string longer than %d bytes", kMaxStringLength);
+
+    m_dest[m_destLength++] = byte;
+}
+
+void StringParser::AppendSequence(std::string_view sequence)
+{
+    if (sequence.length() > (std::size_t)(kMaxStringLength - m_destLength))
+        RaiseError("mapped string longer than %d bytes", kMaxStringLength);
 
-    return totalSequence;
+    for (char c : sequence)
+        m_dest[m_destLength++] = c;
 }
 
 // Reads a charmap string.
@@ -177,23 +190,21 @@ int StringParser::ParseString(long srcPos, unsigned char* dest, int& destLength)
 
     m_pos++;
 
-    destLength = 0;
+    m_dest = dest;
+    m_destLength = 0;
 
     while (m_buffer[m_pos] != '"')
     {
-        std::string sequence = (m_buffer[m_pos] == '{') ? ReadBracketedConstants() : ReadCharOrEscape();
-
-        for (const char& c : sequence)
-        {
-            if (destLength == kMaxStringLength)
-                RaiseError("mapped string longer than %d bytes", kMaxStringLength);
-
-            dest[destLength++] = c;
-        }
+        if (m_buffer[m_pos] == '{')
+            ReadBracketedConstants();
+        else
+            AppendSequence(ReadCharOrEscape());
     }
 
     m_pos++; // Go past the right quote.
 
+    destLength = m_destLength;
+
     return m_pos - start;
 }
 